@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <vector>
+
+#include "LCD_Color.h"
+#include "LCD_Image.h"
+
+//reads the next number of a PPM header, skipping white space and comments
+static bool read_Number(FILE *f, unsigned &value) {
+    int c = fgetc(f);
+    while (c != EOF && (isspace(c) || c == '#')) {
+        if (c == '#') while (c != EOF && c != '\n') c = fgetc(f);
+        c = fgetc(f);
+    }
+    if (c == EOF || !isdigit(c)) return false;
+
+    value = 0;
+    while (c != EOF && isdigit(c)) {
+        value = value * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return true;
+}
+
+//loads a binary (P6) or plain (P3) PPM as RGB565
+static bool load_PPM(const char *path, unsigned &w, unsigned &h, std::vector<uint16_t> &pixels) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+
+    char magic[2];
+    unsigned maxVal;
+    bool isOk = fread(magic, 1, 2, f) == 2 && magic[0] == 'P' && (magic[1] == '6' || magic[1] == '3') &&
+        read_Number(f, w) && read_Number(f, h) && read_Number(f, maxVal) && maxVal > 0 && maxVal < 256 &&
+        w > 0 && w <= 0xFFFF && h > 0 && h <= 0xFFFF;
+
+    pixels.resize(isOk ? (size_t)w * h : 0);
+    for (size_t i = 0; isOk && i < pixels.size(); i++) {
+        unsigned rgb[3];
+        for (int k = 0; k < 3 && isOk; k++) {
+            if (magic[1] == '6') {
+                int c = fgetc(f);
+                isOk = c != EOF;
+                rgb[k] = (unsigned)c;
+            } else {
+                isOk = read_Number(f, rgb[k]);
+            }
+            rgb[k] = rgb[k] * 255 / maxVal;
+        }
+        pixels[i] = WV_RP2040::get_RGB565(rgb[0], rgb[1], rgb[2]);
+    }
+
+    fclose(f);
+    return isOk;
+}
+
+//packs a row into runs and literals, a run pays off from 2 pixels, within literals from 3
+static void encode_Row(const uint16_t *row, unsigned w, std::vector<uint8_t> &out) {
+    unsigned i = 0;
+    while (i < w) {
+        unsigned run = 1;
+        while (i + run < w && run < WV_RP2040_LCD_IMAGE_MAX_PACKET && row[i + run] == row[i]) run++;
+
+        if (run >= 2) {
+            out.push_back((uint8_t)(WV_RP2040_LCD_IMAGE_RUN | (run - 1)));
+            out.push_back((uint8_t)(row[i] & 0xFF));
+            out.push_back((uint8_t)(row[i] >> 8));
+            i += run;
+            continue;
+        }
+
+        unsigned n = 1;
+        while (i + n < w && n < WV_RP2040_LCD_IMAGE_MAX_PACKET) {
+            if (i + n + 2 < w && row[i + n] == row[i + n + 1] && row[i + n] == row[i + n + 2]) break;
+            n++;
+        }
+        out.push_back((uint8_t)(n - 1));
+        for (unsigned k = 0; k < n; k++) {
+            out.push_back((uint8_t)(row[i + k] & 0xFF));
+            out.push_back((uint8_t)(row[i + k] >> 8));
+        }
+        i += n;
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: NavourAssets <image.ppm> <output.h> <name> [transparent RRGGBB]\n");
+        return 2;
+    }
+    const char *name = argv[3];
+
+    unsigned w, h;
+    std::vector<uint16_t> pixels;
+    if (!load_PPM(argv[1], w, h, pixels)) {
+        fprintf(stderr, "could not read %s, only P6 and P3 PPMs are taken\n", argv[1]);
+        return 1;
+    }
+
+    bool isKeyed = argc > 4;
+    uint16_t key = 0;
+    if (isKeyed) {
+        unsigned long rgb = strtoul(argv[4], NULL, 16);
+        key = WV_RP2040::get_RGB565((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF);
+    }
+
+    std::vector<uint8_t> data;
+    for (unsigned y = 0; y < h; y++) encode_Row(&pixels[(size_t)y * w], w, data);
+
+    FILE *f = fopen(argv[2], "w");
+    if (!f) {
+        fprintf(stderr, "could not write %s\n", argv[2]);
+        return 1;
+    }
+
+    const char *base = strrchr(argv[1], '/');
+    fprintf(f, "//written by NavourAssets from %s, %ux%u, %zu bytes instead of %zu\n", (base) ? base + 1 : argv[1], w, h, data.size(), pixels.size() * 2);
+    fprintf(f, "#pragma once\n#include \"LCD_Image.h\"\n\n");
+    fprintf(f, "static const uint8_t %s_data[%zu] = {", name, data.size());
+    for (size_t i = 0; i < data.size(); i++) fprintf(f, "%s0x%02X,", (i % 16) ? " " : "\n    ", data[i]);
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "static const WV_RP2040::WV_RP2040_LCD_IMAGE %s = { %u, %u, %s, 0x%04X, %s_data, sizeof(%s_data) };\n",
+        name, w, h, isKeyed ? "true" : "false", key, name, name);
+    return fclose(f) == 0 ? 0 : 1;
+}
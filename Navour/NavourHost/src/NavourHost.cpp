@@ -0,0 +1,335 @@
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "pico/stdlib.h"
+
+#include "WV_RP2040_LCD.h"
+#include "LCD_Capture.h"
+#include "LCD_Console.h"
+#include "LCD_Emulator.h"
+#include "LCD_Terminal.h"
+#include "LCD_Profiler.h"
+#include "LCD_Blend.h"
+#include "LCD_Memory.h"
+#include "navour_icon.h"
+
+//anti-aliased disc, coverage of every pixel from 4x4 samples
+#define DISC_SIZE 24
+static const uint8_t *get_DiscMask() {
+    static uint8_t mask[DISC_SIZE * DISC_SIZE];
+    for (int y = 0; y < DISC_SIZE; y++) {
+        for (int x = 0; x < DISC_SIZE; x++) {
+            int hits = 0;
+            for (int s = 0; s < 16; s++) {
+                float dx = x + (s % 4 + 0.5f) / 4 - DISC_SIZE / 2.0f, dy = y + (s / 4 + 0.5f) / 4 - DISC_SIZE / 2.0f;
+                if (dx * dx + dy * dy <= (DISC_SIZE / 2.0f) * (DISC_SIZE / 2.0f)) hits++;
+            }
+            mask[y * DISC_SIZE + x] = (uint8_t)(hits * 255 / 16);
+        }
+    }
+    return mask;
+}
+
+//one draw call measured on the ST7789 model
+typedef struct {
+    const char *name;
+    void (*draw)(WV_RP2040::WV_RP2040_LCD &lcd);
+} Primitive;
+
+static const Primitive primitives[] = {
+    { "clear",          [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.clear_Screen(0x0000); } },
+    { "hline",          [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_Line(10, 20, 229, 20, 0xFFFF); } },
+    { "line",           [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_Line(10, 30, 229, 90, 0xFFE0); } },
+    { "rectangle",      [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_Rectangle(10, 100, 60, 40, 0xF800); } },
+    { "round_rect",     [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.fill_RoundRect(80, 100, 60, 40, 10, 0x07E0); } },
+    { "circle",         [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_Circle(190, 120, 30, 0x001F); } },
+    { "fill_circle",    [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.fill_Circle(190, 120, 20, 0x07FF); } },
+    { "fill_triangle",  [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.fill_Triangle(20, 230, 60, 160, 100, 230, 0xF81F); } },
+    { "fill_polygon",   [](WV_RP2040::WV_RP2040_LCD &lcd) {
+        const WV_RP2040::WV_RP2040_LCD_POINT hex[] = { { 150, 160 }, { 180, 160 }, { 195, 190 }, { 180, 220 }, { 150, 220 }, { 135, 190 } };
+        lcd.fill_Polygon(hex, 6, 0xFD20);
+    } },
+    { "string_1x",      [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_String(10, 2, "Navour 0.1[Alpha Build]", 0xFFFF, 0x0000); } },
+    { "string_2x",      [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_String(10, 50, "12.34`C", 0xFFFF, 0x0000, 2); } },
+    { "image",          [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_Image(200, 2, navour_icon); } },
+    { "image_opaque",   [](WV_RP2040::WV_RP2040_LCD &lcd) {
+        WV_RP2040::WV_RP2040_LCD_IMAGE opaque = navour_icon;
+        opaque.isKeyed = false;
+        lcd.draw_Image(220, 40, opaque); //clipped at the right edge
+    } },
+    { "fill_alpha",     [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.fill_RectAlpha(40, 80, 120, 40, 0x001F, 128); } }, //read back, no framebuffer
+    { "mask",           [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_Mask(160, 200, DISC_SIZE, DISC_SIZE, get_DiscMask(), 0xFFE0, 0x0000); } },
+    { "image_alpha",    [](WV_RP2040::WV_RP2040_LCD &lcd) { lcd.draw_Image(200, 80, navour_icon, 96); } },
+};
+
+int main(int argc, char **argv) {
+    auto& lcd = WV_RP2040::WV_RP2040_LCD::get_Inst();
+    auto& emu = WV_RP2040::WV_RP2040_LCD_Emulator::get_Inst();
+
+    //snapshots go into the given directory
+    const char *outDir = (argc > 1) ? argv[1] : ".";
+
+    //init the std input and output
+    stdio_init_all();
+
+    //one line per primitive, csv so CI can track bytes per frame
+    printf("primitive,bytes,transactions,cs_assertions,dc_flips,commands,pixels\n");
+
+    //every primitive in both pixel formats, the RGB444 ones get a suffix
+    const WV_RP2040::WV_RP2040_LCD_COLOR_MODE modes[] = { WV_RP2040::COLOR_RGB444, WV_RP2040::COLOR_RGB565 };
+    for (WV_RP2040::WV_RP2040_LCD_COLOR_MODE mode : modes) {
+        const char *suffix = (mode == WV_RP2040::COLOR_RGB444) ? "_444" : "";
+        lcd.initialize_LCD(WV_RP2040::WV_RP2040_LCD::TRANSPORT_SPI, mode);
+
+        for (const Primitive &p : primitives) {
+            emu.reset_Stats();
+            WV_RP2040_LCD_PROF_FRAME_BEGIN();
+            p.draw(lcd);
+            lcd.wait_Idle();
+            WV_RP2040_LCD_PROF_FRAME_END();
+
+            const WV_RP2040::WV_RP2040_LCD_EMU_STATS &s = emu.get_Stats();
+            printf("%s%s,%u,%u,%u,%u,%u,%u\n", p.name, suffix, (unsigned)s.bytes, (unsigned)s.transactions,
+                (unsigned)s.csAssertions, (unsigned)s.dcFlips, (unsigned)s.commands, (unsigned)s.pixels);
+
+            char path[256];
+            snprintf(path, sizeof(path), "%s/%s%s.ppm", outDir, p.name, suffix);
+            if (!emu.dump_PPM(path, WV_RP2040_LCD_WIDTH, WV_RP2040_LCD_HEIGHT)) {
+                printf("could not write %s\n", path);
+                return 1;
+            }
+        }
+    }
+
+    char path[256];
+
+    //every orientation, a logical pixel must land on the turned panel position and read back
+    for (int o = 0; o < 8; o++) {
+        WV_RP2040::WV_RP2040_LCD::WV_RP2040_LCD_ORIENTATION rot = (WV_RP2040::WV_RP2040_LCD::WV_RP2040_LCD_ORIENTATION)(o & 3);
+        bool isMirrored = o >= 4;
+        if (!lcd.set_Orientation(rot, isMirrored)) {
+            printf("orientation %d refused\n", o);
+            return 1;
+        }
+        lcd.clear_Screen(0x0000);
+        lcd.draw_Pixel(5, 2, 0xF800);
+        lcd.draw_String(10, 10, "Navour", 0xFFFF, 0x0000, 2);
+        lcd.wait_Idle();
+
+        int x = isMirrored ? WV_RP2040_LCD_WIDTH - 1 - 5 : 5, y = 2, px, py;
+        switch (rot) {
+        case WV_RP2040::WV_RP2040_LCD::ORIENT_90:   px = WV_RP2040_LCD_WIDTH - 1 - y; py = x; break;
+        case WV_RP2040::WV_RP2040_LCD::ORIENT_180:  px = WV_RP2040_LCD_WIDTH - 1 - x; py = WV_RP2040_LCD_HEIGHT - 1 - y; break;
+        case WV_RP2040::WV_RP2040_LCD::ORIENT_270:  px = y; py = WV_RP2040_LCD_HEIGHT - 1 - x; break;
+        default:                                    px = x; py = y; break;
+        }
+        uint16_t back = 0;
+        lcd.read_Region(5, 2, 5, 2, &back);
+        if (emu.get_Pixel(px, py) != 0xF800 || back != 0xF800) {
+            printf("orientation %d misplaced\n", o);
+            return 1;
+        }
+    }
+    snprintf(path, sizeof(path), "%s/orientation.ppm", outDir);
+    if (!emu.dump_PPM(path, WV_RP2040_LCD_WIDTH, WV_RP2040_LCD_HEIGHT)) {
+        printf("could not write %s\n", path);
+        return 1;
+    }
+    lcd.set_Orientation(WV_RP2040::WV_RP2040_LCD::ORIENT_0);
+
+    //scrolling console, more lines than the panel shows, so the last print only scrolls
+    auto& console = WV_RP2040::WV_RP2040_LCD_Console::get_Inst();
+    console.begin(0x07E0, 0x0000);
+    for (int i = 0; i < WV_RP2040_LCD_CONSOLE_LINES + 5; i++) {
+        char line[WV_RP2040_LCD_CONSOLE_COLS + 1];
+        snprintf(line, sizeof(line), "console line %d", i);
+        if (i == WV_RP2040_LCD_CONSOLE_LINES + 4) emu.reset_Stats();
+        console.print(line);
+    }
+    lcd.wait_Idle();
+
+    const WV_RP2040::WV_RP2040_LCD_EMU_STATS &s = emu.get_Stats();
+    printf("console_line,%u,%u,%u,%u,%u,%u\n", (unsigned)s.bytes, (unsigned)s.transactions,
+        (unsigned)s.csAssertions, (unsigned)s.dcFlips, (unsigned)s.commands, (unsigned)s.pixels);
+
+    snprintf(path, sizeof(path), "%s/console.ppm", outDir);
+    if (!emu.dump_PPM(path, WV_RP2040_LCD_WIDTH, WV_RP2040_LCD_HEIGHT)) {
+        printf("could not write %s\n", path);
+        return 1;
+    }
+    console.end();
+
+    //stdio terminal, a progress line rewritten with '\r' only repaints the changed cells
+    auto& term = WV_RP2040::WV_RP2040_LCD_Terminal::get_Inst();
+    term.begin(0xFFE0, 0x0000);
+    for (int i = 0; i < WV_RP2040_LCD_TERM_ROWS + 3; i++) {
+        char line[WV_RP2040_LCD_TERM_COLS + 1];
+        int len = snprintf(line, sizeof(line), "terminal line %d\n", i);
+        term.write(line, len);
+    }
+    term.write("progress 10%", 12);
+    term.flush();
+    lcd.wait_Idle();
+    emu.reset_Stats();
+    term.write("\rprogress 20%", 13);
+    term.flush();
+    lcd.wait_Idle();
+
+    const WV_RP2040::WV_RP2040_LCD_EMU_STATS &t = emu.get_Stats();
+    printf("terminal_cell,%u,%u,%u,%u,%u,%u\n", (unsigned)t.bytes, (unsigned)t.transactions,
+        (unsigned)t.csAssertions, (unsigned)t.dcFlips, (unsigned)t.commands, (unsigned)t.pixels);
+
+    snprintf(path, sizeof(path), "%s/terminal.ppm", outDir);
+    if (!emu.dump_PPM(path, WV_RP2040_LCD_WIDTH, WV_RP2040_LCD_HEIGHT)) {
+        printf("could not write %s\n", path);
+        return 1;
+    }
+    term.end();
+
+    //screenshot of the terminal, read back through RAMRD and written as text
+    snprintf(path, sizeof(path), "%s/capture.txt", outDir);
+    FILE *shot = fopen(path, "w");
+    if (!shot) {
+        printf("could not write %s\n", path);
+        return 1;
+    }
+    auto& capture = WV_RP2040::WV_RP2040_LCD_Capture::get_Inst();
+    capture.set_Sink([](const char *text, size_t len, void *ctx) { fwrite(text, 1, len, (FILE *)ctx); }, shot);
+    emu.reset_Stats();
+    uint32_t shotBytes = capture.capture();
+    fclose(shot);
+    capture.set_Sink(NULL, NULL);
+
+    const WV_RP2040::WV_RP2040_LCD_EMU_STATS &c = emu.get_Stats();
+    printf("capture,%u,%u,%u,%u,%u,%u\n", (unsigned)c.bytes, (unsigned)c.transactions,
+        (unsigned)c.csAssertions, (unsigned)c.dcFlips, (unsigned)c.commands, (unsigned)c.pixels);
+    printf("capture_text,%u,0,0,0,0,0\n", (unsigned)shotBytes);
+
+    //the readback must match the model pixel for pixel
+    uint16_t readRow[WV_RP2040_LCD_WIDTH];
+    for (uint16_t y = 0; y < WV_RP2040_LCD_GRAM_HEIGHT; y++) {
+        lcd.read_Region(0, y, WV_RP2040_LCD_WIDTH - 1, y, readRow);
+        for (uint16_t x = 0; x < WV_RP2040_LCD_WIDTH; x++) {
+            if (readRow[x] != emu.get_Pixel(x, y)) {
+                printf("readback differs at %u,%u\n", (unsigned)x, (unsigned)y);
+                return 1;
+            }
+        }
+    }
+
+    //async batches, the callback marks the batch done, a notify costs no bus traffic
+    static uint32_t doneCount = 0;
+    emu.reset_Stats();
+    lcd.clear_Screen(0x0000);
+    WV_RP2040::WV_RP2040_LCD_TOKEN first = lcd.submit([](WV_RP2040::WV_RP2040_LCD_TOKEN, void *) { doneCount++; });
+    lcd.fill_Circle(120, 120, 40, 0xF800);
+    WV_RP2040::WV_RP2040_LCD_TOKEN second = lcd.submit();
+    lcd.wait_Done(second);
+    if (!lcd.is_Done(first) || doneCount != 1 || lcd.get_InFlight()) {
+        printf("async batches did not complete\n");
+        return 1;
+    }
+
+    const WV_RP2040::WV_RP2040_LCD_EMU_STATS &a = emu.get_Stats();
+    printf("async_batches,%u,%u,%u,%u,%u,%u\n", (unsigned)a.bytes, (unsigned)a.transactions,
+        (unsigned)a.csAssertions, (unsigned)a.dcFlips, (unsigned)a.commands, (unsigned)a.pixels);
+
+    //blend kernels against the per channel reference, same results, time per pixel
+    printf("kernel,naive_ns_per_px,packed_ns_per_px\n");
+    const int benchPx = 4096, benchRuns = 2000;
+    static uint16_t under[benchPx], over[benchPx], ref[benchPx], packed[benchPx];
+    static uint8_t coverage[benchPx];
+    const uint8_t *disc = get_DiscMask();
+    for (int i = 0; i < benchPx; i++) {
+        under[i] = (uint16_t)(i * 2654435761u >> 7);
+        over[i] = (uint16_t)(i * 40503u + 12345u);
+        coverage[i] = disc[i % (DISC_SIZE * DISC_SIZE)];
+    }
+    for (int alpha = 0; alpha < 256; alpha++) {
+        memcpy(packed, under, sizeof(under));
+        WV_RP2040::blend_Over(packed, over, (uint8_t)alpha, benchPx);
+        for (int i = 0; i < benchPx; i++) {
+            if (packed[i] != WV_RP2040::blend_RGB565(over[i], under[i], (uint8_t)alpha)) {
+                printf("blend_over differs at alpha %d\n", alpha);
+                return 1;
+            }
+        }
+    }
+    for (int k = 0; k < 3; k++) {
+        const char *names[] = { "blend_fill", "blend_mask", "blend_over" };
+        double ns[2];
+        for (int packedRun = 0; packedRun < 2; packedRun++) {
+            uint16_t *dst = packedRun ? packed : ref;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < benchRuns; r++) {
+                memcpy(dst, under, sizeof(under));
+                uint8_t alpha = (uint8_t)(r * 37);
+                if (packedRun) {
+                    if (k == 0) WV_RP2040::blend_Fill(dst, 0xFD20, alpha, benchPx);
+                    else if (k == 1) WV_RP2040::blend_Mask(dst, 0xFD20, coverage, benchPx);
+                    else WV_RP2040::blend_Over(dst, over, alpha, benchPx);
+                } else {
+                    for (int i = 0; i < benchPx; i++) {
+                        if (k == 0) dst[i] = WV_RP2040::blend_RGB565(0xFD20, dst[i], alpha);
+                        else if (k == 1) dst[i] = WV_RP2040::blend_RGB565(0xFD20, dst[i], coverage[i]);
+                        else dst[i] = WV_RP2040::blend_RGB565(over[i], dst[i], alpha);
+                    }
+                }
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            ns[packedRun] = std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)benchPx * benchRuns);
+        }
+        if (memcmp(ref, packed, sizeof(ref))) {
+            printf("%s differs from the reference\n", names[k]);
+            return 1;
+        }
+        printf("%s,%.3f,%.3f\n", names[k], ns[0], ns[1]);
+    }
+
+    //LVGL heap under churn, mostly small objects and some draw buffers, contents must survive
+    auto &mem = WV_RP2040::WV_RP2040_LCD_Memory::get_Inst();
+    mem.reset();
+    const int slots = 256;
+    static uint8_t *held[slots];
+    static uint16_t heldSize[slots];
+    uint32_t seed = 1;
+    for (int step = 0; step < 20000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        int i = (seed >> 8) % slots;
+        if (held[i] && (seed & 1)) {
+            for (uint16_t b = 0; b < heldSize[i]; b++) {
+                if (held[i][b] != (uint8_t)(i + b)) {
+                    printf("heap block %d overwritten\n", i);
+                    return 1;
+                }
+            }
+            mem.release(held[i]);
+            held[i] = NULL;
+            continue;
+        }
+        uint16_t size = (seed >> 20) % 8 ? 4 + (seed >> 16) % 200 : 256 + (seed >> 12) % 3000;
+        uint8_t *p = (uint8_t *)(held[i] ? mem.resize(held[i], size) : mem.alloc(size));
+        if (!p) continue;
+        uint16_t kept = held[i] && heldSize[i] < size ? heldSize[i] : 0;
+        for (uint16_t b = kept; b < size; b++) p[b] = (uint8_t)(i + b);
+        held[i] = p;
+        heldSize[i] = size;
+        if (step % 1000 == 0 && !mem.check()) {
+            printf("heap corrupted at step %d\n", step);
+            return 1;
+        }
+    }
+    mem.print();
+    for (int i = 0; i < slots; i++) mem.release(held[i]);
+    WV_RP2040::WV_RP2040_LCD_MEM_STATS ms;
+    mem.get_Stats(ms);
+    if (!mem.check() || ms.liveBytes || ms.arenaFreeBlocks != 1) {
+        printf("heap not whole again after releasing everything\n");
+        return 1;
+    }
+
+    //per primitive counters of the profiler, only with WV_RP2040_LCD_PROFILE
+    WV_RP2040_LCD_PROF_PRINT();
+    return 0;
+}
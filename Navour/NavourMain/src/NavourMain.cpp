@@ -5,6 +5,13 @@
 
 #include "ADC_Util.h"
 #include "WV_RP2040_LCD.h"
+#include "LCD_LVGL.h"
+#include "LCD_Backlight.h"
+#include "LCD_Terminal.h"
+#include "LCD_Profiler.h"
+#include "LCD_Memory.h"
+#include "LCD_OS.h"
+#include "LCD_Chart.h"
 
 //function to embbed the signature
 bool embbedSignature() {
@@ -12,11 +19,81 @@ bool embbedSignature() {
     return true;
 }
 
+//prints the status report, the temperature goes onto the label if there is one
+static void print_Report(lv_obj_t *tempLabel) {
+    printf("Hello from Navour!!!\n");
+    printf("The world is your Navmesh!!!\n");
+    float tempC = WV_RP2040::WV_RP2040_ADC::get_Inst().get_OnboardTemparature(false);
+    printf("Onboard Sensor Temp : %.2f`C", tempC);
+    if (tempLabel) {
+        char tempText[16];
+        snprintf(tempText, sizeof(tempText), "%.2f`C", tempC);
+        lv_label_set_text(tempLabel, tempText);
+        WV_RP2040::WV_RP2040_LCD_Memory::get_Inst().print(); //LVGL heap usage and fragmentation
+    }
+    WV_RP2040_LCD_PROF_PRINT(); //bus summary, only with WV_RP2040_LCD_PROFILE
+}
+
+//raw reading of the temparature sensor to tenths of a degree, the unit of the chart
+static int32_t to_TempTenths(uint16_t raw) {
+    return (int32_t)(WV_RP2040::WV_RP2040_ADC::conv_RawTemp(raw) * 10.0f);
+}
+
+#if NAVOUR_LVGL_BENCH
+//frames rendered for each of the two runs of the benchmark
+#define NAVOUR_BENCH_FRAMES 50
+
+//renders a busy screen with one software draw unit working at a time and with both, the times go to stdio and the screen
+static void run_Bench() {
+    lv_obj_t *screen = lv_screen_active();
+    lv_obj_set_style_bg_color(screen, lv_color_hex(0x102030), 0);
+    lv_obj_set_style_bg_grad_color(screen, lv_color_hex(0x405060), 0);
+    lv_obj_set_style_bg_grad_dir(screen, LV_GRAD_DIR_VER, 0);
+
+    //rounded, shadowed and gradient buttons, text and an arc, all of it rasterized in software
+    for (int i = 0; i < 6; i++) {
+        lv_obj_t *btn = lv_button_create(screen);
+        lv_obj_set_size(btn, 100, 40);
+        lv_obj_set_pos(btn, 12 + (i & 1) * 116, 10 + (i >> 1) * 52);
+        lv_obj_set_style_radius(btn, 12, 0);
+        lv_obj_set_style_shadow_width(btn, 16, 0);
+        lv_obj_set_style_bg_grad_color(btn, lv_color_hex(0xC04000), 0);
+        lv_obj_set_style_bg_grad_dir(btn, LV_GRAD_DIR_HOR, 0);
+        lv_obj_t *text = lv_label_create(btn);
+        lv_label_set_text_fmt(text, "Button %d", i);
+        lv_obj_center(text);
+    }
+    lv_obj_t *arc = lv_arc_create(screen);
+    lv_obj_set_size(arc, 64, 64);
+    lv_obj_align(arc, LV_ALIGN_BOTTOM_LEFT, 12, -8);
+    lv_arc_set_value(arc, 70);
+    lv_obj_t *result = lv_label_create(screen);
+    lv_obj_align(result, LV_ALIGN_BOTTOM_RIGHT, -12, -16);
+    lv_label_set_text(result, "Rendering...");
+
+    auto& os = WV_RP2040::WV_RP2040_LCD_OS::get_Inst();
+    uint32_t frameUs[2];
+    for (int units = 1; units <= 2; units++) {
+        os.set_Parallel(units == 2);
+        uint64_t start = time_us_64();
+        for (int i = 0; i < NAVOUR_BENCH_FRAMES; i++) {
+            lv_obj_invalidate(screen);
+            lv_refr_now(NULL);
+        }
+        frameUs[units - 1] = (uint32_t)((time_us_64() - start) / NAVOUR_BENCH_FRAMES);
+    }
+
+    uint32_t speedup = frameUs[1] ? frameUs[0] * 100 / frameUs[1] : 0;
+    printf("LVGL frame, %u draw threads: 1 unit %lu us, 2 units %lu us, x%lu.%02lu\n", os.get_ThreadCount(),
+        (unsigned long)frameUs[0], (unsigned long)frameUs[1], (unsigned long)(speedup / 100), (unsigned long)(speedup % 100));
+    lv_label_set_text_fmt(result, "1 unit  %lu.%lu ms\n2 units %lu.%lu ms",
+        (unsigned long)(frameUs[0] / 1000), (unsigned long)(frameUs[0] / 100 % 10),
+        (unsigned long)(frameUs[1] / 1000), (unsigned long)(frameUs[1] / 100 % 10));
+}
+#endif
 
 int main() {
     
-    bool lit = false;
-    auto& adc = WV_RP2040::WV_RP2040_ADC::get_Inst();
     auto& lcd = WV_RP2040::WV_RP2040_LCD::get_Inst();
 
 
@@ -29,16 +106,66 @@ int main() {
     //print signature
     printf("Navour 0.1[Alpha Build]\nPBWA CORP.\n\n");
 
+    //bring up the screen and the ui on top of it
+    lcd.initialize_LCD();
+    WV_RP2040::WV_RP2040_LCD_Backlight::get_Inst().fade_To(WV_RP2040_LCD_BL_LEVELS - 1, 500); //runs on the DMA
+#if NAVOUR_LCD_TERMINAL
+    //printf output goes to the panel as well as to USB
+    auto& term = WV_RP2040::WV_RP2040_LCD_Terminal::get_Inst();
+    term.begin(0x07E0, 0x0000);
+#else
+    auto& ui = WV_RP2040::WV_RP2040_LCD_LVGL::get_Inst();
+
+#if NAVOUR_LVGL_BENCH
+    //one unit against two, the result stays on the screen
+    run_Bench();
+#else
+    lv_obj_t *tempLabel = lv_label_create(lv_screen_active());
+    lv_obj_center(tempLabel);
+
+    //the report is an LVGL timer, so the loop below has nothing to poll
+    lv_timer_create([](lv_timer_t *t) { print_Report((lv_obj_t *)lv_timer_get_user_data(t)); }, 1000, tempLabel);
+    print_Report(tempLabel);
+
+    //live temparature plot, sampled at 50 Hz into a ring buffer, only the new columns are redrawn
+    static WV_RP2040::WV_RP2040_ADC_Ring tempRing;
+    static WV_RP2040::WV_RP2040_ADC::WV_RP2040_ADC_STREAM tempStream;
+    WV_RP2040::WV_RP2040_ADC::get_Inst().start_Stream(tempStream, tempRing, WV_RP2040::WV_RP2040_ADC::ADC_AINSEL_PIN_TEMP, 20);
+
+    lv_obj_t *chart = lv_chart_create(lv_screen_active());
+    lv_obj_set_size(chart, 220, 96);
+    lv_obj_align(chart, LV_ALIGN_BOTTOM_MID, 0, -8);
+    lv_chart_set_point_count(chart, 200);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 150, 450); //15 - 45`C
+    lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR); //a line without dots
+    lv_chart_series_t *tempSeries = lv_chart_add_series(chart, lv_color_hex(0xFF8000), LV_CHART_AXIS_PRIMARY_Y);
+    static WV_RP2040::WV_RP2040_LCD_Chart tempPlot(chart, tempSeries, tempRing, to_TempTenths);
+    tempPlot.start(20);
+#endif
+#endif
+
     //work for now
+#if NAVOUR_LCD_TERMINAL
+    uint32_t nextReport = 0;
+    while (true) {
+        uint32_t now = to_ms_since_boot(get_absolute_time());
+        if (now >= nextReport) {
+            print_Report(NULL);
+            nextReport = now + 1000;
+        }
+
+        //paints output left without a line break once its time budget ran out
+        term.handle_Pending();
+        sleep_ms(WV_RP2040_LCD_TERM_BUDGET_US / 1000);
+    }
+#else
     while (true) {
-        printf("Hello from Navour!!!\n");
-        printf("The world is your Navmesh!!!\n");
-        float tempC = adc.get_OnboardTemparature(false);
-        printf("Onboard Sensor Temp : %.2f`C", tempC);
-        lcd.set_Backlight(lit);
-        lit = !lit;
-        sleep_ms(1000);
+        //sleeps until LVGL is due, then renders the invalidated areas, flushes run on the DMA while the next band renders
+        WV_RP2040_LCD_PROF_FRAME_BEGIN();
+        ui.run();
+        WV_RP2040_LCD_PROF_FRAME_END();
     }
+#endif
 
     return 0;
 }
\ No newline at end of file
@@ -47,7 +47,8 @@
  * - LV_STDLIB_RTTHREAD:    RT-Thread implementation
  * - LV_STDLIB_CUSTOM:      Implement the functions externally
  */
-#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+/*LV_STDLIB_CUSTOM: size class pools and a TLSF arena, see LCD_Memory.h*/
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CUSTOM
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 
@@ -97,10 +98,11 @@
  * - LV_OS_WINDOWS
  * - LV_OS_MQX
  * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_NONE
+/*The port of LCD_OS.h, the draw threads run on core1 and beside the main loop on core0*/
+#define LV_USE_OS   LV_OS_CUSTOM
 
 #if LV_USE_OS == LV_OS_CUSTOM
-    #define LV_OS_CUSTOM_INCLUDE <stdint.h>
+    #define LV_OS_CUSTOM_INCLUDE "lv_os_navour.h"
 #endif
 
 /*========================
@@ -126,12 +128,16 @@
  */
 #define LV_DRAW_THREAD_STACK_SIZE    (8 * 1024)   /*[bytes]*/
 
+/*Everything the DMA draw unit of LCD_DrawUnit.h does not take*/
 #define LV_USE_DRAW_SW 1
 #if LV_USE_DRAW_SW == 1
     /* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
-     * > 1 means multiply threads will render the screen in parallel */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+     * > 1 means multiply threads will render the screen in parallel
+     * LCD_OS.h runs up to 2, set from CMake by WV_RP2040_LCD_LVGL_DRAW_UNITS */
+    #ifndef LV_DRAW_SW_DRAW_UNIT_CNT
+    #define LV_DRAW_SW_DRAW_UNIT_CNT    2
+    #endif
 
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
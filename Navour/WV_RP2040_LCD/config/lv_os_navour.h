@@ -0,0 +1,38 @@
+/**
+ * @file lv_os_navour.h
+ * Types of the LV_OS_CUSTOM port of Navour, included by LVGL through LV_OS_CUSTOM_INCLUDE.
+ * Plain C, LVGL is built without the pico SDK, the functions are in LCD_OS.cpp.
+ */
+
+#ifndef LV_OS_NAVOUR_H
+#define LV_OS_NAVOUR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*A thread, core1 or the second context of core0*/
+typedef struct {
+    void (*callback)(void *);   /*Thread function*/
+    void * user_data;           /*Argument of the thread function*/
+    uint8_t context;            /*Context running the thread, 0 if not started*/
+} lv_thread_t;
+
+/*Recursive mutex, owned by a context*/
+typedef struct {
+    volatile uint8_t owner;     /*Context holding the mutex, 0 if free*/
+    volatile uint16_t depth;    /*Nested locks of the owner*/
+} lv_mutex_t;
+
+/*Binary event, a signal is consumed by one wait*/
+typedef struct {
+    volatile uint8_t is_signaled;
+} lv_thread_sync_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*LV_OS_NAVOUR_H*/
@@ -0,0 +1,210 @@
+#ifndef _WV_RP_2040_LCD_BACKLIGHT_HEADER_
+#define _WV_RP_2040_LCD_BACKLIGHT_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** \file WV_RP2040_LCD/LCD_Backlight.h
+ *  \headerfile LCD_Backlight.h
+ *  \defgroup WV_RP2040_LCD_Backlight WV_RP2040_LCD_Backlight api dims the backlight of the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief PWM backlight of the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The backlight pin is driven by a hardware PWM slice. Brightness is set in perceptual
+ *  levels, a gamma corrected table built by the compiler turns them into duty cycles, so
+ *  a linear fade looks linear.
+ *
+ *  Fades are precomputed into a table of compare values which a DMA channel writes into
+ *  the PWM slice, paced by the wrap of a second, otherwise unused PWM slice. Once started
+ *  a fade costs no CPU time, the compare value is double buffered by the slice, so every
+ *  step lands on a PWM period boundary.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Backlight
+ *
+ *  \include LCD_Backlight.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Backlight PWM Wrap [65534]
+*  \brief Value
+*  \details Counter top of the backlight slice, 1.9 kHz at 125 MHz, a compare value of wrap + 1 is fully on.
+*  \ingroup WV_RP2040_LCD_Backlight
+*/
+#define WV_RP2040_LCD_BL_PWM_WRAP 0xFFFE // Backlight PWM counter top
+
+/*! \def WV RP2040 LCD Backlight Levels [256]
+*  \brief Value
+*  \details Perceptual brightness levels, 0 is off.
+*  \ingroup WV_RP2040_LCD_Backlight
+*/
+#define WV_RP2040_LCD_BL_LEVELS 256 // Brightness levels
+
+/*! \def WV RP2040 LCD Backlight Gamma [2.2]
+*  \brief Value
+*  \details Exponent of the brightness curve, duty = level ^ gamma.
+*  \ingroup WV_RP2040_LCD_Backlight
+*/
+#ifndef WV_RP2040_LCD_BL_GAMMA
+#define WV_RP2040_LCD_BL_GAMMA 2.2 // Brightness curve exponent
+#endif
+
+/*! \def WV RP2040 LCD Backlight Fade Steps [64]
+*  \brief Value
+*  \details Compare values per fade, the DMA writes one per pacing period.
+*  \ingroup WV_RP2040_LCD_Backlight
+*/
+#ifndef WV_RP2040_LCD_BL_FADE_STEPS
+#define WV_RP2040_LCD_BL_FADE_STEPS 64 // Steps of a fade
+#endif
+
+/*! \def WV RP2040 LCD Backlight Pacing Slice [7]
+*  \brief Value
+*  \details PWM slice whose wrap paces the fade DMA, its pins (GPIO 14, 15) stay unaffected.
+*  \ingroup WV_RP2040_LCD_Backlight
+*/
+#ifndef WV_RP2040_LCD_BL_PACE_SLICE
+#define WV_RP2040_LCD_BL_PACE_SLICE 7 // PWM slice timing the fades
+#endif
+
+/*! \brief WV RP2040 LCD Backlight LUT
+*   \ingroup WV_RP2040_LCD_Backlight
+*
+*   Compare value of the backlight slice for every brightness level.
+*/
+typedef struct _WV_RP2040_LCD_BL_LUT_ {
+    uint16_t duty[WV_RP2040_LCD_BL_LEVELS];
+} WV_RP2040_LCD_BL_LUT;
+
+/*! \brief Get Gamma LUT
+*  \ingroup WV_RP2040_LCD_Backlight
+*
+*  Builds the brightness table, level ^ gamma as x^2 * x^(gamma - 2), the fractional
+*  power by Newton steps on the root, so it runs in a constant expression.
+*
+*  \return The table, every level above 0 gets at least a duty of 1.
+*/
+constexpr WV_RP2040_LCD_BL_LUT get_GammaLUT() {
+    WV_RP2040_LCD_BL_LUT lut = {};
+    constexpr double frac = WV_RP2040_LCD_BL_GAMMA - 2.0;
+    static_assert(frac >= 0.0 && frac < 1.0, "WV_RP2040_LCD_BL_GAMMA must lie in [2, 3)");
+
+    for (int i = 1; i < WV_RP2040_LCD_BL_LEVELS; i++) {
+        double x = (double)i / (WV_RP2040_LCD_BL_LEVELS - 1);
+
+        // x^frac = (x^(1/10))^(10 * frac), the tenth root converges from 1 downwards
+        double r = 1.0;
+        for (int n = 0; n < 64; n++) {
+            double r9 = r * r * r * r * r * r * r * r * r;
+            r = (9.0 * r + x / r9) / 10.0;
+        }
+        double p = x * x;
+        for (int n = 0; n < (int)(frac * 10.0 + 0.5); n++) p *= r;
+
+        uint32_t duty = (uint32_t)(p * (WV_RP2040_LCD_BL_PWM_WRAP + 1) + 0.5);
+        lut.duty[i] = (uint16_t)((duty < 1) ? 1 : duty);
+    }
+    return lut;
+}
+
+/*! \brief WV RP2040 LCD Backlight Gamma LUT
+*   \ingroup WV_RP2040_LCD_Backlight
+*/
+inline constexpr WV_RP2040_LCD_BL_LUT WV_RP2040_LCD_BL_GAMMA_LUT = get_GammaLUT();
+
+static_assert(WV_RP2040_LCD_BL_GAMMA_LUT.duty[0] == 0, "Level 0 must be off");
+static_assert(WV_RP2040_LCD_BL_GAMMA_LUT.duty[WV_RP2040_LCD_BL_LEVELS - 1] == WV_RP2040_LCD_BL_PWM_WRAP + 1, "The top level must be fully on");
+static_assert(WV_RP2040_LCD_BL_GAMMA_LUT.duty[128] < (WV_RP2040_LCD_BL_PWM_WRAP + 1) / 4, "Half brightness is well below half duty");
+
+/*! \class WV_RP2040_LCD_Backlight
+ *  \ingroup WV_RP2040_LCD_Backlight
+ *  \brief WV_RP2040_LCD_Backlight class
+ *
+ *  Singleton PWM backlight, WV_RP2040_LCD::set_Backlight() uses it too.
+ */
+class WV_RP2040_LCD_Backlight
+{
+private:
+    uint32_t steps[WV_RP2040_LCD_BL_FADE_STEPS]; /*!< Compare register values of the running fade */
+    uint8_t blSlice;        /*!< PWM slice of the backlight pin */
+    uint8_t blChannel;      /*!< PWM channel of the backlight pin */
+    int dmaChannel;         /*!< Claimed DMA channel feeding the fades */
+    uint8_t level;          /*!< Level set last, the start of a fade */
+    uint8_t fadeTo;         /*!< Target of the running fade */
+    uint8_t fadeSteps;      /*!< Steps of the running fade */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Backlight
+    *  \category Local Function
+    *
+    *  Hands the backlight pin to its PWM slice, off, and claims the DMA channel.
+    */
+    WV_RP2040_LCD_Backlight();
+
+    WV_RP2040_LCD_Backlight( const WV_RP2040_LCD_Backlight & ) = delete;
+    WV_RP2040_LCD_Backlight& operator=( const WV_RP2040_LCD_Backlight & ) = delete;
+
+    /*! \brief Stop Fade
+    *  \ingroup WV_RP2040_LCD_Backlight
+    *  \category Local Function
+    *
+    *  Aborts a running fade, the level it reached is kept.
+    */
+    void stop_Fade();
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_Backlight
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_Backlight & get_Inst();
+
+    /*! \brief Set Level
+    *  \ingroup WV_RP2040_LCD_Backlight
+    *
+    *  Sets the brightness right away, a running fade is stopped.
+    *
+    *  \param setLevel The brightness, 0 (off) - 255.
+    */
+    void set_Level(uint8_t setLevel);
+
+    /*! \brief Get Level
+    *  \ingroup WV_RP2040_LCD_Backlight
+    *
+    *  \return The brightness the backlight shows, in between while fading.
+    */
+    uint8_t get_Level() const;
+
+    /*! \brief Fade To
+    *  \ingroup WV_RP2040_LCD_Backlight
+    *
+    *  Starts a fade from the current brightness and returns right away, the DMA does
+    *  the rest. The pacing slice runs down to about 7.5 Hz, so fades longer than about
+    *  8 seconds are shortened.
+    *
+    *  \param target The brightness at the end of the fade.
+    *  \param ms The duration of the fade in milliseconds, 0 sets the level right away.
+    */
+    void fade_To(uint8_t target, uint32_t ms);
+
+    /*! \brief Is Fading
+    *  \ingroup WV_RP2040_LCD_Backlight
+    *
+    *  \return True while a fade is running.
+    */
+    bool is_Fading() const;
+};
+
+}
+
+#endif
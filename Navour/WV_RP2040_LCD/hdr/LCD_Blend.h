@@ -0,0 +1,105 @@
+#ifndef _WV_RP_2040_LCD_BLEND_HEADER_
+#define _WV_RP_2040_LCD_BLEND_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** \file WV_RP2040_LCD/LCD_Blend.h
+ *  \headerfile LCD_Blend.h
+ *  \defgroup WV_RP2040_LCD_Blend WV_RP2040_LCD_Blend api blends RGB565 pixels for the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Alpha blending kernels for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The kernels work on two RGB565 pixels per 32 bit word. Each channel of both pixels is
+ *  moved into its own 16 bit lane, so one multiply scales that channel of both pixels:
+ *
+ *  \code
+ *  r = (p >> 11) & 0x001F001F      red of pixel 1 | red of pixel 0
+ *  g = (p >> 5)  & 0x003F003F      green
+ *  b =  p        & 0x001F001F      blue
+ *  r = ((fr * a + r * (256 - a)) >> 8) & 0x001F001F
+ *  \endcode
+ *
+ *  A lane holds at most 63 * 256, so nothing carries into the next one. Three multiplies
+ *  (one for a constant color) blend two pixels, the per channel code needs twelve. The
+ *  result is bit exact with blend_RGB565(), which is the reference.
+ *
+ *  Alpha is 0 (dst kept) - 255 (src), it is widened to 0 - 256 as a + (a >> 7).
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Blend
+ *
+ *  \include LCD_Blend.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \brief Blend RGB565
+*  \ingroup WV_RP2040_LCD_Blend
+*
+*  Blends one pixel channel by channel, for single pixels and as the reference of the
+*  packed kernels.
+*
+*  \param fg The RGB565 color drawn.
+*  \param bg The RGB565 color underneath.
+*  \param alpha The opacity of fg, 0 - 255.
+*  \return The blended RGB565 color.
+*/
+constexpr uint16_t blend_RGB565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+    uint32_t a = alpha + (alpha >> 7), inv = 256 - a;
+    uint32_t r = (((fg >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * inv) >> 8;
+    uint32_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * inv) >> 8;
+    uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * inv) >> 8;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static_assert(blend_RGB565(0xFFFF, 0x0000, 255) == 0xFFFF && blend_RGB565(0xFFFF, 0x1234, 0) == 0x1234, "The ends must be exact");
+static_assert(blend_RGB565(0xF800, 0x001F, 128) == 0x780F, "Half way between red and blue");
+
+/*! \brief Blend Fill
+*  \ingroup WV_RP2040_LCD_Blend
+*
+*  Blends one color over a run of pixels.
+*
+*  \param dst The RGB565 pixels, blended in place.
+*  \param color The RGB565 color drawn.
+*  \param alpha The opacity of color, 0 - 255.
+*  \param count The number of pixels.
+*/
+void blend_Fill(uint16_t *dst, uint16_t color, uint8_t alpha, size_t count);
+
+/*! \brief Blend Mask
+*  \ingroup WV_RP2040_LCD_Blend
+*
+*  Blends one color over a run of pixels through an 8 bit coverage mask, as it comes
+*  from an anti-aliased glyph. Pairs of equal coverage, which is most of a glyph, take
+*  the packed path, fully covered and empty pixels are not computed at all.
+*
+*  \param dst The RGB565 pixels, blended in place.
+*  \param color The RGB565 color drawn.
+*  \param mask The opacity of color for every pixel, 0 - 255.
+*  \param count The number of pixels.
+*/
+void blend_Mask(uint16_t *dst, uint16_t color, const uint8_t *mask, size_t count);
+
+/*! \brief Blend Over
+*  \ingroup WV_RP2040_LCD_Blend
+*
+*  Blends a run of pixels over another one, image over image.
+*
+*  \param dst The RGB565 pixels underneath, blended in place.
+*  \param src The RGB565 pixels drawn.
+*  \param alpha The opacity of src, 0 - 255.
+*  \param count The number of pixels.
+*/
+void blend_Over(uint16_t *dst, const uint16_t *src, uint8_t alpha, size_t count);
+
+}
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef _WV_RP_2040_LCD_CAPTURE_HEADER_
+#define _WV_RP_2040_LCD_CAPTURE_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "WV_RP2040_LCD.h"
+
+/** \file WV_RP2040_LCD/LCD_Capture.h
+ *  \headerfile LCD_Capture.h
+ *  \defgroup WV_RP2040_LCD_Capture WV_RP2040_LCD_Capture api takes screenshots of the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Screenshot capture of the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The frame memory of the controller is read back one row at a time, so no shadow
+ *  framebuffer is needed, and every row is sent run length encoded as soon as it is
+ *  read. The output is plain text, so it survives a USB CDC terminal translating line
+ *  breaks:
+ *
+ *  \code
+ *  SHOT <x> <y> <w> <h>
+ *  <row>:<run><run>...
+ *  END <runs>
+ *  \endcode
+ *
+ *  Every run is six hex digits, the run length minus one and the RGB565 color, so
+ *  "1F0000" are 32 black pixels. Runs do not cross rows.
+ *
+ *  The capture writes to stdout by default, end WV_RP2040_LCD_Terminal first or the
+ *  output is drawn into the screen being captured.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Capture
+ *
+ *  \include LCD_Capture.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Capture Chunk [96]
+*  \brief Value
+*  \details Characters collected before they are handed to the sink.
+*  \ingroup WV_RP2040_LCD_Capture
+*/
+#define WV_RP2040_LCD_CAPTURE_CHUNK 96 // Characters per sink call
+
+/*! \brief WV RP2040 LCD Capture Sink
+*   \ingroup WV_RP2040_LCD_Capture
+*
+*   Receives the encoded text of a capture piece by piece.
+*/
+typedef void (*WV_RP2040_LCD_CAPTURE_SINK)(const char *text, size_t len, void *ctx);
+
+/*! \class WV_RP2040_LCD_Capture
+ *  \ingroup WV_RP2040_LCD_Capture
+ *  \brief WV_RP2040_LCD_Capture class
+ *
+ *  Singleton screenshot encoder, call capture() once the LCD is initialized.
+ */
+class WV_RP2040_LCD_Capture
+{
+private:
+    uint16_t row[WV_RP2040_LCD_WIDTH];          /*!< Pixels of the row being encoded */
+    char text[WV_RP2040_LCD_CAPTURE_CHUNK];     /*!< Encoded text not yet handed to the sink */
+    size_t textLen;                             /*!< Characters in text */
+    uint32_t sentBytes;                         /*!< Characters handed to the sink by the current capture */
+    WV_RP2040_LCD_CAPTURE_SINK sink;            /*!< Destination of the encoded text */
+    void *sinkCtx;                              /*!< Passed to the sink */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Capture
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_Capture();
+
+    WV_RP2040_LCD_Capture( const WV_RP2040_LCD_Capture & ) = delete;
+    WV_RP2040_LCD_Capture& operator=( const WV_RP2040_LCD_Capture & ) = delete;
+
+    /*! \brief Put Text
+    *  \ingroup WV_RP2040_LCD_Capture
+    *  \category Local Function
+    *
+    *  Appends characters, hands the collected text to the sink whenever it is full.
+    */
+    void put_Text(const char *str, size_t len);
+
+    /*! \brief Flush Text
+    *  \ingroup WV_RP2040_LCD_Capture
+    *  \category Local Function
+    */
+    void flush_Text();
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_Capture
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_Capture & get_Inst();
+
+    /*! \brief Set Sink
+    *  \ingroup WV_RP2040_LCD_Capture
+    *
+    *  \param setSink The destination of the encoded text, NULL for stdout.
+    *  \param ctx Passed to the sink.
+    */
+    void set_Sink(WV_RP2040_LCD_CAPTURE_SINK setSink, void *ctx);
+
+    /*! \brief Capture
+    *  \ingroup WV_RP2040_LCD_Capture
+    *
+    *  Reads the region row by row and sends it run length encoded. Everything queued
+    *  before is drawn first.
+    *
+    *  \param x The left column of the region.
+    *  \param y The top row of the region.
+    *  \param w The width of the region.
+    *  \param h The height of the region.
+    *  \return The number of characters sent, 0 if the region could not be read.
+    */
+    uint32_t capture(uint16_t x = 0, uint16_t y = 0, uint16_t w = WV_RP2040_LCD_WIDTH, uint16_t h = WV_RP2040_LCD_HEIGHT);
+};
+
+}
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef _WV_RP_2040_LCD_CHART_HEADER_
+#define _WV_RP_2040_LCD_CHART_HEADER_
+
+#include <stdint.h>
+
+#include "lvgl.h"
+#include "ADC_Ring.h"
+
+/** \file WV_RP2040_LCD/LCD_Chart.h
+ *  \headerfile LCD_Chart.h
+ *  \defgroup WV_RP2040_LCD_Chart WV_RP2040_LCD_Chart api plots ADC samples on an LVGL chart.
+ *  \author TheClownDev
+ *
+ *  \brief Binding of an ADC sample ring buffer to a series of an lv_chart.
+ *
+ *  New samples are taken from the ring and written straight into the point array of the
+ *  series, which is used as a ring itself. The chart runs in circular mode, the points
+ *  stay where they are and a cursor sweeps over the plot, the point after the newest one
+ *  is left empty as the gap between new and old data.
+ *
+ *  Only the columns of the new points and their neighbours are invalidated. In shift
+ *  mode every point moves one column per sample and LVGL invalidates the whole chart,
+ *  a 200 point plot at 50 Hz would redraw all of it 50 times a second. Here the line
+ *  renderer only walks the few columns within the invalidated area.
+ *
+ *  Typical use:
+ *  \code
+ *  static WV_RP2040::WV_RP2040_ADC_Ring ring;
+ *  static WV_RP2040::WV_RP2040_ADC::WV_RP2040_ADC_STREAM stream;
+ *  adc.start_Stream(stream, ring, WV_RP2040::WV_RP2040_ADC::ADC_AINSEL_PIN_TEMP, 20); //50 Hz
+ *
+ *  lv_obj_t *chart = lv_chart_create(lv_screen_active());
+ *  lv_chart_set_point_count(chart, 200);
+ *  lv_chart_series_t *series = lv_chart_add_series(chart, lv_color_hex(0xFF8000), LV_CHART_AXIS_PRIMARY_Y);
+ *  static WV_RP2040::WV_RP2040_LCD_Chart plot(chart, series, ring, to_Tenths);
+ *  plot.start(20);
+ *  \endcode
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Chart
+ *
+ *  \include LCD_Chart.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Chart Batch [32]
+*  \brief Value
+*  \details Samples taken from the ring at once.
+*  \ingroup WV_RP2040_LCD_Chart
+*/
+#define WV_RP2040_LCD_CHART_BATCH 32 // Samples per ring read
+
+/*! \brief WV RP2040 LCD Chart Convert
+*   \ingroup WV_RP2040_LCD_Chart
+*
+*   Turns a raw sample into the value plotted, NULL plots the raw samples.
+*/
+typedef int32_t (*WV_RP2040_LCD_CHART_CONV)(uint16_t raw);
+
+/*! \class WV_RP2040_LCD_Chart
+ *  \ingroup WV_RP2040_LCD_Chart
+ *  \brief WV_RP2040_LCD_Chart class
+ *
+ *  One series of a chart fed from one ADC ring buffer.
+ */
+class WV_RP2040_LCD_Chart
+{
+private:
+    lv_obj_t *chart;                    /*!< The chart */
+    lv_chart_series_t *series;          /*!< The series plotted */
+    const WV_RP2040_ADC_Ring &ring;     /*!< Where the samples come from */
+    WV_RP2040_LCD_CHART_CONV conv;      /*!< Raw sample to value, NULL for none */
+    uint32_t tail;                      /*!< Samples of the ring plotted so far */
+    uint32_t cursor;                    /*!< Point the next sample goes to */
+    lv_timer_t *timer;                  /*!< Timer calling update(), NULL if not started */
+
+    WV_RP2040_LCD_Chart( const WV_RP2040_LCD_Chart & ) = delete;
+    WV_RP2040_LCD_Chart& operator=( const WV_RP2040_LCD_Chart & ) = delete;
+
+    /*! \brief Timer Callback
+    *  \ingroup WV_RP2040_LCD_Chart
+    *  \category Local Function
+    */
+    static void timer_CB(lv_timer_t *t);
+
+    /*! \brief Invalidate Points
+    *  \ingroup WV_RP2040_LCD_Chart
+    *  \category Local Function
+    *
+    *  Invalidates the columns of points, with the lines to their neighbours.
+    *
+    *  \param first The first point, wraps around the end of the series.
+    *  \param count The points.
+    */
+    void invalidate_Points(uint32_t first, uint32_t count);
+
+    /*! \brief Invalidate Columns
+    *  \ingroup WV_RP2040_LCD_Chart
+    *  \category Local Function
+    *
+    *  Invalidates the plot from the column of one point to the column of another.
+    */
+    void invalidate_Columns(uint32_t from, uint32_t to);
+
+public:
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Chart
+    *
+    *  Switches the chart to circular mode and clears the series, plotting starts with the
+    *  next sample pushed to the ring.
+    *
+    *  \param chart The chart, with its point count set.
+    *  \param series The series of the chart fed.
+    *  \param ring The ring buffer of the samples, has to outlive the binding.
+    *  \param conv Turns a raw sample into the value plotted, NULL plots the raw samples.
+    */
+    WV_RP2040_LCD_Chart(lv_obj_t *chart, lv_chart_series_t *series, const WV_RP2040_ADC_Ring &ring, WV_RP2040_LCD_CHART_CONV conv);
+
+    /*! \brief Destructor
+    *  \ingroup WV_RP2040_LCD_Chart
+    *
+    *  Stops the timer, the chart is left as it is.
+    */
+    ~WV_RP2040_LCD_Chart();
+
+    /*! \brief Start
+    *  \ingroup WV_RP2040_LCD_Chart
+    *
+    *  Calls update() from an LVGL timer.
+    *
+    *  \param periodMs The time between two updates, the sample interval or longer.
+    */
+    void start(uint32_t periodMs);
+
+    /*! \brief Update
+    *  \ingroup WV_RP2040_LCD_Chart
+    *
+    *  Plots the samples pushed since the last update and invalidates their columns.
+    *
+    *  \return The samples plotted.
+    */
+    uint32_t update();
+};
+
+}
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef _WV_RP_2040_LCD_COLOR_HEADER_
+#define _WV_RP_2040_LCD_COLOR_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** \file WV_RP2040_LCD/LCD_Color.h
+ *  \headerfile LCD_Color.h
+ *  \defgroup WV_RP2040_LCD_Color WV_RP2040_LCD_Color api converts colors for the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Compile time color helpers for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The controller takes RGB565 (two bytes per pixel) or RGB444 (three bytes per two
+ *  pixels). All helpers are constexpr, so constant colors are converted, swapped or
+ *  packed by the compiler and cost nothing at run time.
+ *
+ *  \code
+ *  constexpr uint16_t ORANGE = WV_RP2040::get_RGB565(255, 165, 0);
+ *  constexpr uint16_t ORANGE_444 = WV_RP2040::to_RGB444(ORANGE);
+ *  static_assert(ORANGE_444 == 0x0FA0, "converted by the compiler");
+ *  \endcode
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Color
+ *
+ *  \include LCD_Color.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \brief WV RP2040 LCD Color Mode
+*   \ingroup WV_RP2040_LCD_Color
+*
+*   Pixel format of the controller interface (COLMOD).
+*/
+typedef enum _WV_RP2040_LCD_COLOR_MODE_ {
+    COLOR_RGB565            = 0, //16 bits per pixel, 65536 colors
+    COLOR_RGB444            = 1, //12 bits per pixel, 4096 colors, 25% less bus time
+} WV_RP2040_LCD_COLOR_MODE;
+
+/*! \brief Get RGB565
+*  \ingroup WV_RP2040_LCD_Color
+*
+*  \param r The red channel (0 - 255).
+*  \param g The green channel (0 - 255).
+*  \param b The blue channel (0 - 255).
+*  \return The RGB565 color.
+*/
+constexpr uint16_t get_RGB565(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+/*! \brief Get RGB444
+*  \ingroup WV_RP2040_LCD_Color
+*
+*  \param r The red channel (0 - 255).
+*  \param g The green channel (0 - 255).
+*  \param b The blue channel (0 - 255).
+*  \return The RGB444 color in the low 12 bits.
+*/
+constexpr uint16_t get_RGB444(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r & 0xF0) << 4) | (g & 0xF0) | (b >> 4));
+}
+
+/*! \brief To RGB444
+*  \ingroup WV_RP2040_LCD_Color
+*
+*  Keeps the top four bits of every channel.
+*
+*  \param c The RGB565 color.
+*  \return The RGB444 color in the low 12 bits.
+*/
+constexpr uint16_t to_RGB444(uint16_t c) {
+    return (uint16_t)(((c >> 4) & 0x0F00) | ((c >> 3) & 0x00F0) | ((c >> 1) & 0x000F));
+}
+
+/*! \brief To RGB565
+*  \ingroup WV_RP2040_LCD_Color
+*
+*  Widens every channel by repeating its top bits, so white stays white.
+*
+*  \param c The RGB444 color in the low 12 bits.
+*  \return The RGB565 color.
+*/
+constexpr uint16_t to_RGB565(uint16_t c) {
+    return (uint16_t)((((c >> 8) & 0xF) << 12) | (((c >> 8) & 0x8) << 8) |
+        (((c >> 4) & 0xF) << 7) | (((c >> 4) & 0xC) << 3) |
+        ((c & 0xF) << 1) | ((c & 0x8) >> 3));
+}
+
+/*! \brief Get Native
+*  \ingroup WV_RP2040_LCD_Color
+*
+*  \param c The RGB565 color.
+*  \param mode The pixel format of the controller.
+*  \return The color as the controller takes it in the given mode.
+*/
+constexpr uint16_t get_Native(uint16_t c, WV_RP2040_LCD_COLOR_MODE mode) {
+    return (mode == COLOR_RGB444) ? to_RGB444(c) : c;
+}
+
+/*! \brief Swap Bytes
+*  \ingroup WV_RP2040_LCD_Color
+*
+*  Pre-swaps a color for buffers streamed byte wise from a little endian CPU, the
+*  controller takes the high byte first.
+*
+*  \param c The RGB565 color.
+*  \return The color with its bytes swapped.
+*/
+constexpr uint16_t swap_Bytes(uint16_t c) {
+    return (uint16_t)((c << 8) | (c >> 8));
+}
+
+/*! \brief Pack RGB444
+*  \ingroup WV_RP2040_LCD_Color
+*
+*  Packs two RGB444 pixels the way the controller takes them, three bytes, the first
+*  pixel in the top 12 bits.
+*
+*  \param a The first RGB444 pixel.
+*  \param b The second RGB444 pixel.
+*  \return The three bytes in the low 24 bits, the first byte on the wire in bits 23 - 16.
+*/
+constexpr uint32_t pack_RGB444(uint16_t a, uint16_t b) {
+    return ((uint32_t)(a & 0x0FFF) << 12) | (b & 0x0FFF);
+}
+
+/*! \brief Convert RGB444
+*  \ingroup WV_RP2040_LCD_Color
+*
+*  Converts a run of RGB565 pixels, used where whole buffers are sent in RGB444 mode.
+*
+*  \param dst The RGB444 pixels, may be src.
+*  \param src The RGB565 pixels.
+*  \param count The number of pixels.
+*/
+inline void convert_RGB444(uint16_t *dst, const uint16_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++) dst[i] = to_RGB444(src[i]);
+}
+
+static_assert(to_RGB444(0xFFFF) == 0x0FFF && to_RGB565(0x0FFF) == 0xFFFF, "White must survive the conversions");
+static_assert(to_RGB444(get_RGB565(0x12, 0x34, 0x56)) == get_RGB444(0x12, 0x34, 0x56), "RGB444 conversions must agree");
+static_assert(pack_RGB444(0x0ABC, 0x0DEF) == 0xABCDEF, "Two pixels pack into three bytes");
+
+}
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef _WV_RP_2040_LCD_CONSOLE_HEADER_
+#define _WV_RP_2040_LCD_CONSOLE_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "WV_RP2040_LCD.h"
+
+/** \file WV_RP2040_LCD/LCD_Console.h
+ *  \headerfile LCD_Console.h
+ *  \defgroup WV_RP2040_LCD_Console WV_RP2040_LCD_Console api is a scrolling text console on the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Hardware scrolled text console on the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The whole frame memory of the controller is defined as the vertical scroll area
+ *  (VSCRDEF), text lines are written into it as a ring and the scroll start address
+ *  (VSCSAD) moves the newest line to the bottom of the panel. A new line costs one line
+ *  of pixels plus a two byte scroll update, the rest of the screen is never repainted.
+ *
+ *  The last lines are kept in a ring buffer, so the console can be repainted after the
+ *  screen was cleared. The console writes to the controller directly, it does not work
+ *  with the framebuffer of WV_RP2040_LCD.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Console
+ *
+ *  \include LCD_Console.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Console Columns [40]
+*  \brief Value
+*  \details Characters per console line.
+*  \ingroup WV_RP2040_LCD_Console
+*/
+#define WV_RP2040_LCD_CONSOLE_COLS (WV_RP2040_LCD_WIDTH / (WV_RP2040_LCD_FONT_WIDTH + 1)) // Characters per line
+
+/*! \def WV RP2040 LCD Console Lines [30]
+*  \brief Value
+*  \details Lines visible on the panel, also the lines kept for a repaint.
+*  \ingroup WV_RP2040_LCD_Console
+*/
+#define WV_RP2040_LCD_CONSOLE_LINES (WV_RP2040_LCD_HEIGHT / WV_RP2040_LCD_FONT_HEIGHT) // Lines on the panel
+
+/*! \def WV RP2040 LCD Console Slots [40]
+*  \brief Value
+*  \details Lines the frame memory holds, the ring the console scrolls through.
+*  \ingroup WV_RP2040_LCD_Console
+*/
+#define WV_RP2040_LCD_CONSOLE_SLOTS (WV_RP2040_LCD_GRAM_HEIGHT / WV_RP2040_LCD_FONT_HEIGHT) // Lines in frame memory
+
+/*! \class WV_RP2040_LCD_Console
+ *  \ingroup WV_RP2040_LCD_Console
+ *  \brief WV_RP2040_LCD_Console class
+ *
+ *  Singleton scrolling console, call begin() once the LCD is initialized.
+ */
+class WV_RP2040_LCD_Console
+{
+private:
+    char lines[WV_RP2040_LCD_CONSOLE_LINES][WV_RP2040_LCD_CONSOLE_COLS + 1]; /*!< Ring of the last lines */
+    uint32_t lineCount;     /*!< Lines printed since the last clear */
+    uint8_t nextSlot;       /*!< Frame memory slot of the next line */
+    uint8_t shownCount;     /*!< Lines on the panel, scrolling starts once it is full */
+    uint16_t fg;            /*!< Text color */
+    uint16_t bg;            /*!< Background color */
+    bool isActive;          /*!< Flag to check if the scroll area is defined */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Console
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_Console();
+
+    WV_RP2040_LCD_Console( const WV_RP2040_LCD_Console & ) = delete;
+    WV_RP2040_LCD_Console& operator=( const WV_RP2040_LCD_Console & ) = delete;
+
+    /*! \brief Set Scroll
+    *  \ingroup WV_RP2040_LCD_Console
+    *  \category Local Function
+    *
+    *  Sends the scroll start address, the frame memory row shown on the top of the panel.
+    */
+    void set_Scroll(uint16_t row);
+
+    /*! \brief Paint Line
+    *  \ingroup WV_RP2040_LCD_Console
+    *  \category Local Function
+    *
+    *  Writes a text line into the next frame memory slot and scrolls it into view.
+    */
+    void paint_Line(const char *text);
+
+    /*! \brief Add Line
+    *  \ingroup WV_RP2040_LCD_Console
+    *  \category Local Function
+    *
+    *  Stores a line of at most WV_RP2040_LCD_CONSOLE_COLS characters and paints it.
+    */
+    void add_Line(const char *text, size_t len);
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_Console
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_Console & get_Inst();
+
+    /*! \brief Begin
+    *  \ingroup WV_RP2040_LCD_Console
+    *
+    *  Defines the whole frame memory as the scroll area and clears the console, the
+    *  panel goes back to ORIENT_0 as it scrolls along the frame memory rows.
+    *
+    *  \param setFg The text color.
+    *  \param setBg The background color.
+    */
+    void begin(uint16_t setFg, uint16_t setBg);
+
+    /*! \brief End
+    *  \ingroup WV_RP2040_LCD_Console
+    *
+    *  Returns the controller to the normal display mode, the panel shows the frame memory
+    *  unscrolled again.
+    */
+    void end();
+
+    /*! \brief Print
+    *  \ingroup WV_RP2040_LCD_Console
+    *
+    *  Prints text, every '\n' starts a new line and long lines are wrapped.
+    *
+    *  \param text The text to be printed.
+    */
+    void print(const char *text);
+
+    /*! \brief Clear
+    *  \ingroup WV_RP2040_LCD_Console
+    *
+    *  Drops the stored lines and clears the panel.
+    */
+    void clear();
+
+    /*! \brief Redraw
+    *  \ingroup WV_RP2040_LCD_Console
+    *
+    *  Clears the frame memory and repaints the stored lines, for use after something
+    *  else drew over the console.
+    */
+    void redraw();
+
+    /*! \brief Is Active
+    *  \ingroup WV_RP2040_LCD_Console
+    *
+    *  \return True between begin() and end().
+    */
+    bool is_Active() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,346 @@
+#ifndef _WV_RP_2040_LCD_DMA_HEADER_
+#define _WV_RP_2040_LCD_DMA_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+#include "LCD_Transport.h"
+
+/** \file WV_RP2040_LCD/LCD_DMA.h
+ *  \headerfile LCD_DMA.h
+ *  \defgroup WV_RP2040_LCD_DMA WV_RP2040_LCD_DMA api can be used to stream data to the LCD with DMA.
+ *  \author TheClownDev
+ *
+ *  \brief DMA backed transfer engine for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The engine owns the bus of the LCD through a transport. Work is queued as small jobs (commands, solid
+ *  fills and buffer copies) and executed in order from the DMA completion interrupt, so
+ *  the caller returns as soon as the job is queued. Two ping-pong line buffers are
+ *  provided, so that software can fill one while the other is being clocked out.
+ *
+ *  The interrupt is served on the core which first used the engine, jobs may still be
+ *  queued from the other one. A hardware spin lock keeps the two cores from draining
+ *  the ring at the same time.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_DMA
+ *
+ *  \include LCD_DMA.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD DMA Buffer Pixels [480]
+*  \brief Value
+*  \details Size of each of the two ping-pong line buffers in pixels (two scanlines).
+*  \ingroup WV_RP2040_LCD_DMA
+*/
+#ifndef WV_RP2040_LCD_DMA_BUF_PX
+#define WV_RP2040_LCD_DMA_BUF_PX 480 // Pixels per line buffer
+#endif
+
+/*! \def WV RP2040 LCD DMA Queue Length [32]
+*  \brief Value
+*  \details Number of jobs which can be queued before the caller has to wait.
+*  \ingroup WV_RP2040_LCD_DMA
+*/
+#ifndef WV_RP2040_LCD_DMA_QUEUE_LEN
+#define WV_RP2040_LCD_DMA_QUEUE_LEN 32 // Jobs in flight
+#endif
+
+/*! \class WV_RP2040_LCD_DMA
+ *  \ingroup WV_RP2040_LCD_DMA
+ *  \brief WV_RP2040_LCD_DMA class
+ *
+ *  Singleton transfer engine used by WV_RP2040_LCD. All queued jobs are executed strictly
+ *  in order, commands are sent from the interrupt between two DMA transfers.
+ */
+class WV_RP2040_LCD_DMA
+{
+public:
+    /*! \brief Job Type
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Kind of work a queued job describes.
+    */
+    typedef enum _WV_RP2040_LCD_DMA_JOB_TYPE_ {
+        JOB_COMMAND     = 0, //command byte with up to 4 parameter bytes
+        JOB_FILL        = 1, //count pixels of a single color
+        JOB_COPY        = 2, //count pixels from a buffer
+        JOB_NOTIFY      = 3, //callback once every job queued before it is sent
+        JOB_DATA        = 4, //up to 4 data bytes
+    } WV_RP2040_LCD_DMA_JOB_TYPE;
+
+    /*! \brief Notify Callback
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Callback of a JOB_NOTIFY, usually called from the DMA interrupt. It runs with the
+    *  spin lock of the engine held and must not queue jobs.
+    */
+    typedef void (*WV_RP2040_LCD_DMA_NOTIFY_CB)(void *ctx);
+
+private:
+    /*! \brief Job
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  A single queued unit of work.
+    */
+    typedef struct _WV_RP2040_LCD_DMA_JOB_ {
+        uint8_t type;           /*!< One of WV_RP2040_LCD_DMA_JOB_TYPE */
+        uint8_t cmd;            /*!< Command byte for JOB_COMMAND */
+        uint8_t paramCount;     /*!< Number of bytes in params */
+        int8_t lineBuf;         /*!< Line buffer to release on completion, -1 if none */
+        uint8_t params[4];      /*!< Parameter bytes for JOB_COMMAND, data bytes for JOB_DATA */
+        uint16_t color;         /*!< Fill color for JOB_FILL, DMA reads it in place */
+        const uint16_t *src;    /*!< Source pixels for JOB_COPY */
+        uint32_t count;         /*!< Number of pixels for JOB_FILL and JOB_COPY */
+        WV_RP2040_LCD_DMA_NOTIFY_CB notify; /*!< Callback for JOB_NOTIFY */
+        void *ctx;              /*!< Callback context for JOB_NOTIFY */
+    } WV_RP2040_LCD_DMA_JOB;
+
+    WV_RP2040_LCD_Transport *transport; /*!< Bus backend of the LCD */
+    int dmaChannel;     /*!< Claimed DMA channel */
+    uint32_t jobSent;   /*!< Pixels of the current job handed to the transport, long jobs go in chunks */
+    uint8_t pixelBits;  /*!< Bits per pixel on the bus, 16 or 12 */
+    uint16_t originX;   /*!< Frame memory column added to every window */
+    uint16_t originY;   /*!< Frame memory row added to every window */
+
+    WV_RP2040_LCD_DMA_JOB jobs[WV_RP2040_LCD_DMA_QUEUE_LEN]; /*!< Job ring */
+    volatile uint32_t jobHead;  /*!< Next free slot, written by the caller */
+    volatile uint32_t jobTail;  /*!< Job in execution, written by the interrupt */
+    volatile bool isBusy;       /*!< True while the engine is draining the ring */
+    spin_lock_t *lock;          /*!< Hardware spin lock, guards isBusy and pump() against the other core */
+
+    uint16_t lineBufs[2][WV_RP2040_LCD_DMA_BUF_PX]; /*!< Ping-pong line buffers */
+    volatile bool lineBufBusy[2];   /*!< True while a line buffer is owned by the caller or queued */
+    uint8_t nextLineBuf;            /*!< Line buffer handed out next */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_DMA
+    *  \category Local Function
+    *
+    *  Starts the SPI transport, claims the DMA channel and the spin lock and installs the
+    *  completion interrupt.
+    */
+    WV_RP2040_LCD_DMA();
+
+    WV_RP2040_LCD_DMA( const WV_RP2040_LCD_DMA & ) = delete;
+    WV_RP2040_LCD_DMA& operator=( const WV_RP2040_LCD_DMA & ) = delete;
+
+    /*! \brief Push Job
+    *  \ingroup WV_RP2040_LCD_DMA
+    *  \category Local Function
+    *
+    *  Appends a job to the ring, waiting for a free slot if the ring is full, and
+    *  starts the engine if it is idle.
+    *
+    *  \param job The job to be queued.
+    */
+    void push_Job(const WV_RP2040_LCD_DMA_JOB &job);
+
+    /*! \brief Pump
+    *  \ingroup WV_RP2040_LCD_DMA
+    *  \category Local Function
+    *
+    *  Executes queued commands until a pixel job is reached, which is then handed
+    *  to the DMA. Releases the bus when the ring is empty.
+    *  Called with the spin lock held.
+    */
+    void pump();
+
+    /*! \brief Start Chunk
+    *  \ingroup WV_RP2040_LCD_DMA
+    *  \category Local Function
+    *
+    *  Hands the next chunk of a pixel job to the transport.
+    *
+    *  \return True if the transport sent it synchronously.
+    */
+    bool start_Chunk(const WV_RP2040_LCD_DMA_JOB &job);
+
+    /*! \brief Finish Job
+    *  \ingroup WV_RP2040_LCD_DMA
+    *  \category Local Function
+    *
+    *  Retires the current job and releases its line buffer.
+    */
+    void finish_Job();
+
+    /*! \brief DMA IRQ Handler
+    *  \ingroup WV_RP2040_LCD_DMA
+    *  \category Local Function
+    *
+    *  Completion interrupt of the claimed DMA channel.
+    */
+    static void dma_IRQHandler();
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_DMA & get_Inst();
+
+    /*! \brief Queue Command
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Queues a command byte followed by up to 4 parameter bytes.
+    *
+    *  \param cmd The command byte.
+    *  \param params The parameter bytes, can be NULL if paramCount is 0.
+    *  \param paramCount The number of parameter bytes (0 - 4).
+    */
+    void queue_Command(uint8_t cmd, const uint8_t *params, uint8_t paramCount);
+
+    /*! \brief Queue Data
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Queues up to 4 data bytes, not preceded by a command.
+    *
+    *  \param data The data bytes.
+    *  \param count The number of data bytes (1 - 4).
+    */
+    void queue_Data(const uint8_t *data, uint8_t count);
+
+    /*! \brief Queue Window
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Queues the address window commands followed by the memory write command. The
+    *  origin set with set_Origin() is added to the coordinates.
+    *
+    *  \param x0 The starting x-coordinate of the window.
+    *  \param y0 The starting y-coordinate of the window.
+    *  \param x1 The ending x-coordinate of the window (inclusive).
+    *  \param y1 The ending y-coordinate of the window (inclusive).
+    */
+    void queue_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+    /*! \brief Queue Fill
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Queues count pixels of the same color, sent by DMA from a fixed source address.
+    *
+    *  \param color The color in the pixel format set with set_PixelBits().
+    *  \param count The number of pixels.
+    */
+    void queue_Fill(uint16_t color, uint32_t count);
+
+    /*! \brief Queue Copy
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Queues count pixels from a buffer. The buffer must stay valid until the engine is
+    *  idle again, use the line buffers for temporary data.
+    *
+    *  \param src The pixels in the format set with set_PixelBits().
+    *  \param count The number of pixels.
+    */
+    void queue_Copy(const uint16_t *src, uint32_t count);
+
+    /*! \brief Acquire Line Buffer
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Hands out the next ping-pong line buffer, waiting for it to be clocked out if needed.
+    *
+    *  \return Pointer to WV_RP2040_LCD_DMA_BUF_PX pixels owned by the caller until queued.
+    */
+    uint16_t * acquire_LineBuf();
+
+    /*! \brief Queue Line Buffer
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Queues the first count pixels of an acquired line buffer, the buffer is
+    *  released once it has been sent.
+    *
+    *  \param buf The line buffer returned by acquire_LineBuf().
+    *  \param count The number of pixels to be sent.
+    */
+    void queue_LineBuf(uint16_t *buf, uint32_t count);
+
+    /*! \brief Queue Notify
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Queues a callback, called as soon as every job queued before it has been handed
+    *  to the transport, meaning their source buffers can be reused. The callback usually runs
+    *  in the DMA interrupt, keep it short.
+    *
+    *  \param cb The callback.
+    *  \param ctx The context passed to the callback.
+    */
+    void queue_Notify(WV_RP2040_LCD_DMA_NOTIFY_CB cb, void *ctx);
+
+    /*! \brief Is Idle
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Checks if all the queued jobs are done and the bus is released.
+    *
+    *  \return True if idle, false otherwise.
+    */
+    bool is_Idle() const;
+
+    /*! \brief Wait Idle
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Fence, waits until all the queued jobs are done and the bus is released.
+    */
+    void wait_Idle();
+
+    /*! \brief Set Transport
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Waits for the engine to be idle, releases the current transport and starts the new one.
+    *
+    *  \param newTransport The transport to be used from now on.
+    */
+    void set_Transport(WV_RP2040_LCD_Transport &newTransport);
+
+    /*! \brief Set Pixel Bits
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Waits for the engine to be idle and selects the pixel size of the bus, 16 bits
+    *  for RGB565 or 12 bits for RGB444 held in the low bits of each halfword. The
+    *  controller has to be switched with COLMOD to match.
+    *
+    *  \param bits The bits per pixel, 16 or 12.
+    */
+    void set_PixelBits(uint8_t bits);
+
+    /*! \brief Get Pixel Bits
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  \return The bits per pixel on the bus.
+    */
+    uint8_t get_PixelBits() const;
+
+    /*! \brief Set Origin
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  Sets the frame memory address of the logical origin, windows queued before keep
+    *  the origin they were queued with.
+    *
+    *  \param x The column address of x = 0.
+    *  \param y The row address of y = 0.
+    */
+    void set_Origin(uint16_t x, uint16_t y);
+
+    /*! \brief Get Transport
+    *  \ingroup WV_RP2040_LCD_DMA
+    *
+    *  \return The transport in use.
+    */
+    WV_RP2040_LCD_Transport & get_Transport() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef _WV_RP_2040_LCD_DAMAGE_HEADER_
+#define _WV_RP_2040_LCD_DAMAGE_HEADER_
+
+#include <stdint.h>
+
+/** \file WV_RP2040_LCD/LCD_Damage.h
+ *  \headerfile LCD_Damage.h
+ *  \defgroup WV_RP2040_LCD_Damage WV_RP2040_LCD_Damage api can be used to track the damaged areas of the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Dirty rectangle accumulator for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  Records the bounding boxes touched by draw calls. Overlapping or adjacent boxes are
+ *  merged as they come in, and once the cap is reached a new box is merged into the
+ *  box it grows the least, so only a bounded list of regions has to be sent.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Damage
+ *
+ *  \include LCD_Damage.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Damage Max Rects [16]
+*  \brief Value
+*  \details Storage for damaged rectangles, the upper bound of the configurable cap.
+*  \ingroup WV_RP2040_LCD_Damage
+*/
+#ifndef WV_RP2040_LCD_DAMAGE_MAX_RECTS
+#define WV_RP2040_LCD_DAMAGE_MAX_RECTS 16 // Upper bound of the damage cap
+#endif
+
+/*! \brief WV RP2040 LCD Rect
+*   \ingroup WV_RP2040_LCD_Damage
+*
+*   Rectangle with inclusive corners, in pixels.
+*/
+typedef struct _WV_RP2040_LCD_RECT_ {
+    uint16_t x0;
+    uint16_t y0;
+    uint16_t x1;
+    uint16_t y1;
+} WV_RP2040_LCD_RECT;
+
+/*! \class WV_RP2040_LCD_Damage
+ *  \ingroup WV_RP2040_LCD_Damage
+ *  \brief WV_RP2040_LCD_Damage class
+ *
+ *  Bounded list of damaged rectangles.
+ */
+class WV_RP2040_LCD_Damage
+{
+private:
+    WV_RP2040_LCD_RECT rects[WV_RP2040_LCD_DAMAGE_MAX_RECTS]; /*!< Damaged rectangles */
+    uint8_t count;  /*!< Number of damaged rectangles */
+    uint8_t cap;    /*!< Number of rectangles kept before merging is forced */
+
+    /*! \brief Can Merge
+    *  \ingroup WV_RP2040_LCD_Damage
+    *  \category Local Function
+    *
+    *  \return True if the rectangles overlap or share an edge.
+    */
+    static bool can_Merge(const WV_RP2040_LCD_RECT &a, const WV_RP2040_LCD_RECT &b);
+
+    /*! \brief Union
+    *  \ingroup WV_RP2040_LCD_Damage
+    *  \category Local Function
+    *
+    *  \return The bounding box of both rectangles.
+    */
+    static WV_RP2040_LCD_RECT get_Union(const WV_RP2040_LCD_RECT &a, const WV_RP2040_LCD_RECT &b);
+
+    /*! \brief Area
+    *  \ingroup WV_RP2040_LCD_Damage
+    *  \category Local Function
+    *
+    *  \return The area of the rectangle in pixels.
+    */
+    static uint32_t get_Area(const WV_RP2040_LCD_RECT &r);
+
+    /*! \brief Remove
+    *  \ingroup WV_RP2040_LCD_Damage
+    *  \category Local Function
+    *
+    *  Removes the rectangle at index, the last one takes its place.
+    */
+    void remove(uint8_t index);
+
+public:
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Damage
+    */
+    WV_RP2040_LCD_Damage();
+
+    /*! \brief Set Cap
+    *  \ingroup WV_RP2040_LCD_Damage
+    *
+    *  Sets the number of rectangles kept before new ones are forced to merge.
+    *
+    *  \param newCap The cap, clamped to 1 - WV_RP2040_LCD_DAMAGE_MAX_RECTS.
+    */
+    void set_Cap(uint8_t newCap);
+
+    /*! \brief Add
+    *  \ingroup WV_RP2040_LCD_Damage
+    *
+    *  Records a damaged rectangle, merging it with the overlapping and adjacent ones.
+    *
+    *  \param rect The damaged rectangle.
+    */
+    void add(const WV_RP2040_LCD_RECT &rect);
+
+    /*! \brief Get Count
+    *  \ingroup WV_RP2040_LCD_Damage
+    *
+    *  \return The number of damaged rectangles.
+    */
+    uint8_t get_Count() const;
+
+    /*! \brief Get Rect
+    *  \ingroup WV_RP2040_LCD_Damage
+    *
+    *  \param index Index of the rectangle, 0 - get_Count() - 1.
+    *  \return The damaged rectangle.
+    */
+    const WV_RP2040_LCD_RECT & get_Rect(uint8_t index) const;
+
+    /*! \brief Get Damaged Area
+    *  \ingroup WV_RP2040_LCD_Damage
+    *
+    *  \return The sum of the areas of the damaged rectangles, in pixels.
+    */
+    uint32_t get_DamagedArea() const;
+
+    /*! \brief Clear
+    *  \ingroup WV_RP2040_LCD_Damage
+    *
+    *  Forgets all the damaged rectangles.
+    */
+    void clear();
+};
+
+}
+
+#endif
@@ -0,0 +1,315 @@
+#ifndef _WV_RP_2040_LCD_DISPLAY_LIST_HEADER_
+#define _WV_RP_2040_LCD_DISPLAY_LIST_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "WV_RP2040_LCD.h"
+
+/** \file WV_RP2040_LCD/LCD_DisplayList.h
+ *  \headerfile LCD_DisplayList.h
+ *  \defgroup WV_RP2040_LCD_DisplayList WV_RP2040_LCD_DisplayList api records LCD draw calls for core1.
+ *  \author TheClownDev
+ *
+ *  \brief Display lists of the attached onboard LCD screen of WV_RP2040, rendered on core1.
+ *
+ *  Draw calls on core0 append compact opcodes into one of two preallocated command
+ *  buffers and return right away. end_Frame() hands the buffer to the renderer on core1
+ *  through the inter-core FIFO and switches recording to the other buffer, the renderer
+ *  executes the commands with WV_RP2040_LCD and answers through the FIFO once the frame
+ *  is on the bus, which frees the buffer again.
+ *
+ *  Once start() has been called, core1 owns the LCD and the inter-core FIFO, core0 must
+ *  only draw through the display list.
+ *
+ *  Core1 is claimed through WV_RP2040_LCD::claim_Core1(). LVGL started with the draw
+ *  threads of LCD_OS.h holds core1 itself, start() refuses then and the display list
+ *  draws on the calling core.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_DisplayList
+ *
+ *  \include LCD_DisplayList.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Display List Bytes [4096]
+*  \brief Value
+*  \details Size of each of the two command buffers in bytes.
+*  \ingroup WV_RP2040_LCD_DisplayList
+*/
+#ifndef WV_RP2040_LCD_DL_BUF_BYTES
+#define WV_RP2040_LCD_DL_BUF_BYTES 4096 // Bytes per command buffer
+#endif
+
+/*! \class WV_RP2040_LCD_DisplayList
+ *  \ingroup WV_RP2040_LCD_DisplayList
+ *  \brief WV_RP2040_LCD_DisplayList class
+ *
+ *  Singleton display list recorder on core0, renderer on core1. The draw calls mirror
+ *  the ones of WV_RP2040_LCD, they return false once the frame buffer is full and the
+ *  command is dropped.
+ */
+class WV_RP2040_LCD_DisplayList
+{
+public:
+    /*! \brief Opcode
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Command of a display list entry, followed by its int16_t arguments.
+    */
+    typedef enum _WV_RP2040_LCD_DL_OP_ {
+        OP_CLEAR            = 0, //color
+        OP_PIXEL            = 1, //x, y, color
+        OP_LINE             = 2, //x0, y0, x1, y1, color
+        OP_RECT             = 3, //x, y, w, h, color
+        OP_ROUND_RECT       = 4, //x, y, w, h, r, color
+        OP_FILL_ROUND_RECT  = 5, //x, y, w, h, r, color
+        OP_CIRCLE           = 6, //cx, cy, r, color
+        OP_FILL_CIRCLE      = 7, //cx, cy, r, color
+        OP_TRIANGLE         = 8, //x0, y0, x1, y1, x2, y2, color
+        OP_FILL_TRIANGLE    = 9, //x0, y0, x1, y1, x2, y2, color
+        OP_POLYGON          = 10, //color, count, then count points
+        OP_FILL_POLYGON     = 11, //color, count, then count points
+        OP_TEXT             = 12, //x, y, color, bg, scale, then the NUL terminated text
+        OP_BACKLIGHT        = 13, //on
+    } WV_RP2040_LCD_DL_OP;
+
+private:
+    alignas(4) uint8_t bufs[2][WV_RP2040_LCD_DL_BUF_BYTES]; /*!< Command buffers, one recorded while the other renders */
+    bool bufBusy[2];                                /*!< Buffer handed to core1 and not answered yet */
+    uint8_t recBuf;                                 /*!< Buffer being recorded */
+    uint32_t recLen;                                /*!< Bytes recorded into the buffer */
+    bool isStarted;                                 /*!< Flag to check if core1 is running the renderer */
+    WV_RP2040_LCD::WV_RP2040_LCD_TRANSPORT transport; /*!< Transport core1 initializes the LCD with */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_DisplayList();
+
+    WV_RP2040_LCD_DisplayList( const WV_RP2040_LCD_DisplayList & ) = delete;
+    WV_RP2040_LCD_DisplayList& operator=( const WV_RP2040_LCD_DisplayList & ) = delete;
+
+    /*! \brief Record
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *  \category Local Function
+    *
+    *  Appends an opcode, its arguments and optional trailing bytes to the frame.
+    *
+    *  \return False if the frame buffer is full, nothing is recorded then.
+    */
+    bool record(uint8_t op, const int16_t *args, uint8_t argCount, const void *extra = NULL, size_t extraLen = 0);
+
+    /*! \brief Wait Buffer
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *  \category Local Function
+    *
+    *  Collects the answers of core1 until the buffer is free.
+    */
+    void wait_Buffer(uint8_t buf);
+
+    /*! \brief Execute
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *  \category Local Function
+    *
+    *  Runs a recorded frame on the LCD, called on core1.
+    */
+    void execute(const uint8_t *cmds, uint32_t len);
+
+    /*! \brief Core1 Main
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *  \category Local Function
+    *
+    *  Entry of the renderer on core1.
+    */
+    static void core1_Main();
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_DisplayList & get_Inst();
+
+    /*! \brief Start
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Launches the renderer on core1, which initializes the LCD. Returns once the LCD is
+    *  ready. The DMA interrupt stays on core0 if the LCD was used there before, the
+    *  engine takes jobs from either core.
+    *
+    *  \param setTransport The bus backend of the LCD.
+    *  \return False if core1 is claimed by the LVGL draw threads, nothing is launched then.
+    */
+    bool start(WV_RP2040_LCD::WV_RP2040_LCD_TRANSPORT setTransport = WV_RP2040_LCD::TRANSPORT_SPI);
+
+    /*! \brief End Frame
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Hands the recorded frame to core1 and starts recording the next one. Waits only
+    *  when core1 is still rendering the frame before the handed one.
+    */
+    void end_Frame();
+
+    /*! \brief Is Frame Pending
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  \return True while a handed frame has not been rendered yet.
+    */
+    bool is_FramePending();
+
+    /*! \brief Wait Frames
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Waits until every handed frame has been rendered.
+    */
+    void wait_Frames();
+
+    /*! \brief Get Used
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  \return Bytes recorded into the current frame.
+    */
+    uint32_t get_Used() const;
+
+    /*! \brief Clear Screen
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a clear of the whole LCD.
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool clear_Screen(uint16_t color);
+
+    /*! \brief Draw Pixel
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a pixel.
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool draw_Pixel(int16_t x, int16_t y, uint16_t color);
+
+    /*! \brief Draw Line
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a line, see WV_RP2040_LCD::draw_Line().
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool draw_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+    /*! \brief Draw Rectangle
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a filled rectangle, see WV_RP2040_LCD::draw_Rectangle().
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool draw_Rectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+    /*! \brief Draw Rounded Rectangle
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a rounded rectangle outline, see WV_RP2040_LCD::draw_RoundRect().
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool draw_RoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
+
+    /*! \brief Fill Rounded Rectangle
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a filled rounded rectangle, see WV_RP2040_LCD::fill_RoundRect().
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool fill_RoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
+
+    /*! \brief Draw Circle
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a circle outline, see WV_RP2040_LCD::draw_Circle().
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool draw_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color);
+
+    /*! \brief Fill Circle
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a filled circle, see WV_RP2040_LCD::fill_Circle().
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool fill_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color);
+
+    /*! \brief Draw Triangle
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a triangle outline, see WV_RP2040_LCD::draw_Triangle().
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool draw_Triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+    /*! \brief Fill Triangle
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a filled triangle, see WV_RP2040_LCD::fill_Triangle().
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool fill_Triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+    /*! \brief Draw Polygon
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a polygon outline, the vertices are copied into the frame.
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool draw_Polygon(const WV_RP2040_LCD_POINT *pts, uint16_t count, uint16_t color);
+
+    /*! \brief Fill Polygon
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a filled convex polygon, the vertices are copied into the frame.
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool fill_Polygon(const WV_RP2040_LCD_POINT *pts, uint16_t count, uint16_t color);
+
+    /*! \brief Draw String
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a text line, the text is copied into the frame.
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool draw_String(int16_t x, int16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t scale = 1);
+
+    /*! \brief Set Backlight
+    *  \ingroup WV_RP2040_LCD_DisplayList
+    *
+    *  Records a backlight switch, so it lands in order with the drawing.
+    *
+    *  \return False if the frame is full and the command was dropped.
+    */
+    bool set_Backlight(bool setOn);
+};
+
+}
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef _WV_RP_2040_LCD_DRAW_UNIT_HEADER_
+#define _WV_RP_2040_LCD_DRAW_UNIT_HEADER_
+
+#include <stdint.h>
+
+#include "lvgl.h"
+#include "WV_RP2040_LCD.h"
+
+/** \file WV_RP2040_LCD/LCD_DrawUnit.h
+ *  \headerfile LCD_DrawUnit.h
+ *  \defgroup WV_RP2040_LCD_DrawUnit WV_RP2040_LCD_DrawUnit api draws LVGL tasks straight to the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief LVGL draw unit of the attached onboard LCD screen of WV_RP2040.
+ *
+ *  A draw unit next to the software one. It takes the tasks of the display layer which
+ *  need no rasterizing, opaque rectangle fills without radius or gradient and unscaled,
+ *  unrotated opaque RGB565 images, and sends them to the panel through the DMA engine,
+ *  fills from a repeated source, images straight from their pixels. Everything else is
+ *  left to the software unit.
+ *
+ *  The render buffer of the band is still flushed, so the unit keeps track of the rows
+ *  the software unit draws into:
+ *
+ *  - Rows no other task touches and which one direct task covers in full are left out
+ *    of the flush, the panel already holds them. A background fill of a band costs
+ *    neither CPU nor bus time twice.
+ *  - Rows another task draws into are flushed from the buffer, there the direct tasks
+ *    are painted into the buffer too, in their order, so blending below and above them
+ *    stays exact.
+ *
+ *  The unit works with private parts of LVGL, the draw task fields of lvgl_private.h
+ *  (_real_area, preferred_draw_unit_id, preference_score) and the evaluate_cb and
+ *  dispatch_cb contract. They were checked against LVGL v9.3.0, the release fetched by
+ *  the top level CMakeLists.txt, other versions are refused at compile time.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_DrawUnit
+ *
+ *  \include LCD_DrawUnit.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Draw Unit Ops [16]
+*  \brief Value
+*  \details Direct tasks of one band, further ones go to the software unit.
+*  \ingroup WV_RP2040_LCD_DrawUnit
+*/
+#ifndef WV_RP2040_LCD_DRAW_OPS
+#define WV_RP2040_LCD_DRAW_OPS 16 // Direct tasks per band
+#endif
+
+/*! \def WV RP2040 LCD Draw Unit Row Words
+*  \brief Value
+*  \details Words of the row bitmaps, one bit per row of the tallest band.
+*  \ingroup WV_RP2040_LCD_DrawUnit
+*/
+#define WV_RP2040_LCD_DRAW_ROW_WORDS ((WV_RP2040_LCD_HEIGHT + 31) / 32)
+
+/*! \brief WV RP2040 LCD Draw Unit Stats
+*   \ingroup WV_RP2040_LCD_DrawUnit
+*/
+typedef struct _WV_RP2040_LCD_DRAW_STATS_ {
+    uint32_t fills;         //fills sent to the panel
+    uint32_t images;        //images sent to the panel
+    uint32_t rowsSkipped;   //band rows left out of the flush
+    uint32_t rowsFlushed;   //band rows flushed from the buffer
+} WV_RP2040_LCD_DRAW_STATS;
+
+/*! \class WV_RP2040_LCD_DrawUnit
+ *  \ingroup WV_RP2040_LCD_DrawUnit
+ *  \brief WV_RP2040_LCD_DrawUnit class
+ *
+ *  Singleton LVGL draw unit of the on-board LCD.
+ */
+class WV_RP2040_LCD_DrawUnit
+{
+private:
+    /*! \brief WV RP2040 LCD Draw Op
+    *   \ingroup WV_RP2040_LCD_DrawUnit
+    *
+    *   A task taken by the unit.
+    */
+    typedef struct _WV_RP2040_LCD_DRAW_OP_ {
+        const lv_draw_task_t *task; /*!< The task */
+        lv_area_t area;             /*!< Pixels drawn, within the band */
+        const uint8_t *src;         /*!< RGB565 pixels of an image, NULL for a fill */
+        uint32_t stride;            /*!< Bytes per row of the image */
+        int32_t srcX, srcY;         /*!< Screen position of the first image pixel */
+        uint16_t color;             /*!< RGB565 color of a fill */
+        bool isDone;                /*!< True once it was drawn */
+    } WV_RP2040_LCD_DRAW_OP;
+
+    lv_draw_unit_t *unit;   /*!< The unit registered with LVGL */
+    lv_layer_t *layer;      /*!< Display layer of the band, NULL before its first task */
+    WV_RP2040_LCD_DRAW_OP ops[WV_RP2040_LCD_DRAW_OPS];  /*!< Direct tasks of the band, in order */
+    uint8_t opCount;        /*!< Direct tasks of the band */
+    uint32_t neededRows[WV_RP2040_LCD_DRAW_ROW_WORDS];  /*!< Band rows flushed from the buffer */
+    WV_RP2040_LCD_DRAW_STATS stats; /*!< Work taken off the software unit */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_DrawUnit();
+
+    WV_RP2040_LCD_DrawUnit( const WV_RP2040_LCD_DrawUnit & ) = delete;
+    WV_RP2040_LCD_DrawUnit& operator=( const WV_RP2040_LCD_DrawUnit & ) = delete;
+
+    /*! \brief Evaluate Callback
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *  \category Local Function
+    *
+    *  Called for every new task, claims the direct ones and marks the rows of the others.
+    */
+    static int32_t evaluate_CB(lv_draw_unit_t *u, lv_draw_task_t *t);
+
+    /*! \brief Dispatch Callback
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *  \category Local Function
+    *
+    *  Draws the next claimed task which is ready, in place.
+    */
+    static int32_t dispatch_CB(lv_draw_unit_t *u, lv_layer_t *layer);
+
+    /*! \brief Claim
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *  \category Local Function
+    *
+    *  \return True if the task can be drawn straight to the panel, op is filled then.
+    */
+    bool claim(const lv_draw_task_t *t, WV_RP2040_LCD_DRAW_OP &op) const;
+
+    /*! \brief Mark Rows
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *  \category Local Function
+    *
+    *  Marks rows as flushed from the buffer, the direct tasks drawn before are painted
+    *  into the rows which were not marked yet.
+    */
+    void mark_Rows(int32_t y1, int32_t y2);
+
+    /*! \brief Paint
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *  \category Local Function
+    *
+    *  Paints rows of a direct task into the buffer of the band.
+    */
+    void paint(const WV_RP2040_LCD_DRAW_OP &op, int32_t y1, int32_t y2);
+
+    /*! \brief Send
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *  \category Local Function
+    *
+    *  Queues rows of a direct task to the panel.
+    */
+    void send(const WV_RP2040_LCD_DRAW_OP &op, int32_t y1, int32_t y2);
+
+    /*! \brief Is Row Needed
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *  \category Local Function
+    *
+    *  \return True if the band row is flushed from the buffer.
+    */
+    inline bool is_Needed(int32_t row) const {
+        return (neededRows[row >> 5] >> (row & 31)) & 1;
+    }
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_DrawUnit & get_Inst();
+
+    /*! \brief Attach
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *
+    *  Registers the unit with LVGL, after lv_init().
+    */
+    void attach();
+
+    /*! \brief Prepare Flush
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *
+    *  Settles the rows of the band which are flushed, every row not covered in full by a
+    *  direct task is, and paints the direct tasks into those.
+    *
+    *  \param area The area of the band.
+    */
+    void prepare_Flush(const lv_area_t *area);
+
+    /*! \brief Is Row Flushed
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *
+    *  \param y The screen row, within the band passed to prepare_Flush().
+    *  \return True if the row has to be sent from the buffer.
+    */
+    bool is_RowFlushed(int32_t y) const;
+
+    /*! \brief End Band
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *
+    *  Forgets the tasks of the flushed band.
+    */
+    void end_Band();
+
+    /*! \brief Get Stats
+    *  \ingroup WV_RP2040_LCD_DrawUnit
+    *
+    *  \return The work taken off the software unit since start up.
+    */
+    const WV_RP2040_LCD_DRAW_STATS & get_Stats() const;
+};
+
+}
+
+#endif
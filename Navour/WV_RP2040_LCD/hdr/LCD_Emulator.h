@@ -0,0 +1,223 @@
+#ifndef _WV_RP_2040_LCD_EMULATOR_HEADER_
+#define _WV_RP_2040_LCD_EMULATOR_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "LCD_Transport.h"
+#include "LCD_Color.h"
+
+/** \file WV_RP2040_LCD/LCD_Emulator.h
+ *  \headerfile LCD_Emulator.h
+ *  \defgroup WV_RP2040_LCD_Emulator WV_RP2040_LCD_Emulator api is an in-memory ST7789 for host builds.
+ *  \author TheClownDev
+ *
+ *  \brief ST7789 model standing in for the attached onboard LCD screen of WV_RP2040 on the host.
+ *
+ *  Only built with PICO_PLATFORM=host, where it is the transport of the transfer engine.
+ *  The model interprets CASET, RASET, RAMWR, MADCTL and COLMOD into a GRAM image which can be
+ *  read back through RAMRD or dumped as a PPM snapshot, and counts the bus traffic, so the bytes sent
+ *  by every draw call can be tracked without a board. VSCRDEF and VSCSAD are applied
+ *  when the snapshot is taken, as the panel would show the scrolled memory. Pixels are
+ *  turned into the byte stream of the bus first, so RGB444 packing is decoded the way
+ *  the controller would and GRAM keeps RGB565.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Emulator
+ *
+ *  \include LCD_Emulator.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Emulator GRAM Width [240]
+*  \brief Value
+*  \details Columns of the ST7789 frame memory.
+*  \ingroup WV_RP2040_LCD_Emulator
+*/
+#define WV_RP2040_LCD_EMU_GRAM_WIDTH 240 // ST7789 GRAM columns
+
+/*! \def WV RP2040 LCD Emulator GRAM Height [320]
+*  \brief Value
+*  \details Rows of the ST7789 frame memory, the panel shows the first ones.
+*  \ingroup WV_RP2040_LCD_Emulator
+*/
+#define WV_RP2040_LCD_EMU_GRAM_HEIGHT 320 // ST7789 GRAM rows
+
+/*! \brief WV RP2040 LCD Emulator Stats
+*   \ingroup WV_RP2040_LCD_Emulator
+*
+*   Bus traffic counted since the last reset_Stats().
+*/
+typedef struct _WV_RP2040_LCD_EMU_STATS_ {
+    uint32_t bytes;         //bytes clocked, commands, parameters, pixels and read data
+    uint32_t transactions;  //write_Bytes(), read_Bytes() and start_Pixels() calls
+    uint32_t csAssertions;  //chip select assertions
+    uint32_t dcFlips;       //changes of the DC level
+    uint32_t commands;      //command bytes
+    uint32_t pixels;        //pixels written into or read from GRAM
+} WV_RP2040_LCD_EMU_STATS;
+
+/*! \class WV_RP2040_LCD_Emulator
+ *  \ingroup WV_RP2040_LCD_Emulator
+ *  \brief WV_RP2040_LCD_Emulator class
+ *
+ *  Singleton in-memory ST7789 transport, pixels are applied synchronously.
+ */
+class WV_RP2040_LCD_Emulator : public WV_RP2040_LCD_Transport
+{
+private:
+    uint16_t gram[WV_RP2040_LCD_EMU_GRAM_HEIGHT][WV_RP2040_LCD_EMU_GRAM_WIDTH]; /*!< Frame memory */
+    uint8_t cmd;            /*!< Last command byte */
+    uint8_t paramIdx;       /*!< Parameter bytes received for the command */
+    uint8_t params[6];      /*!< Parameter bytes of the command, the bytes of a pixel for RAMWR and RAMRD */
+    uint8_t madctl;         /*!< Memory data access control */
+    uint8_t colmod;         /*!< Interface pixel format */
+    uint16_t xs, xe;        /*!< Column window */
+    uint16_t ys, ye;        /*!< Row window */
+    uint16_t curX, curY;    /*!< Write pointer inside the window */
+    uint16_t tfa, vsa;      /*!< Top fixed and vertical scroll area rows */
+    uint16_t vsp;           /*!< Vertical scroll start address */
+    bool isScrolling;       /*!< Vertical scroll mode, left by NORON */
+    uint8_t pixelBits;      /*!< Bits per pixel sent by start_Pixels(), 16 or 12 */
+    uint32_t bitAcc;        /*!< Pixel bits not yet forming a full byte */
+    uint8_t bitCount;       /*!< Number of bits in bitAcc */
+    bool isDC;              /*!< Current DC level */
+    WV_RP2040_LCD_EMU_STATS stats; /*!< Traffic counters */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_Emulator();
+
+    WV_RP2040_LCD_Emulator( const WV_RP2040_LCD_Emulator & ) = delete;
+    WV_RP2040_LCD_Emulator& operator=( const WV_RP2040_LCD_Emulator & ) = delete;
+
+    /*! \brief Set DC
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *  \category Local Function
+    */
+    void set_DC(bool setData);
+
+    /*! \brief Step Pointer
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *  \category Local Function
+    *
+    *  Maps the memory pointer onto GRAM through MADCTL and advances it.
+    *
+    *  \return The GRAM cell the pointer was at, NULL outside GRAM.
+    */
+    uint16_t * step_Pointer();
+
+    /*! \brief Write Pixel
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *  \category Local Function
+    *
+    *  Stores a pixel at the memory pointer and advances the pointer.
+    */
+    void write_Pixel(uint16_t color);
+
+    /*! \brief Data Byte
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *  \category Local Function
+    *
+    *  Interprets a data byte for the last command.
+    */
+    void data_Byte(uint8_t b);
+
+    /*! \brief Stream Bits
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *  \category Local Function
+    *
+    *  Shifts the bits of a pixel onto the bus, every full byte is interpreted.
+    */
+    void stream_Bits(uint16_t value, uint8_t bits);
+
+    /*! \brief Put Nibble
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *  \category Local Function
+    *
+    *  Shifts 4 zero bits onto the bus.
+    */
+    void put_Nibble() override;
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_Emulator & get_Inst();
+
+    /*! \brief Reset
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *
+    *  Puts the model into its power on state, GRAM is cleared to black.
+    */
+    void reset();
+
+    /*! \brief Get Pixel
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *
+    *  \param x The GRAM column.
+    *  \param y The GRAM row.
+    *  \return The RGB565 pixel, 0 outside GRAM.
+    */
+    uint16_t get_Pixel(uint16_t x, uint16_t y) const;
+
+    /*! \brief Get Display Row
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *
+    *  \param y The panel row.
+    *  \return The GRAM row the panel row shows with the current vertical scrolling.
+    */
+    uint16_t get_DisplayRow(uint16_t y) const;
+
+    /*! \brief Dump PPM
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *
+    *  Writes what the panel shows as a binary PPM, RGB565 widened to 8 bits.
+    *
+    *  \param path The file to be written.
+    *  \param w The width of the snapshot.
+    *  \param h The height of the snapshot.
+    *  \return False if the file could not be written.
+    */
+    bool dump_PPM(const char *path, uint16_t w, uint16_t h) const;
+
+    /*! \brief Get Stats
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *
+    *  \return The traffic counted since the last reset_Stats().
+    */
+    const WV_RP2040_LCD_EMU_STATS & get_Stats() const;
+
+    /*! \brief Reset Stats
+    *  \ingroup WV_RP2040_LCD_Emulator
+    *
+    *  Starts counting a new frame.
+    */
+    void reset_Stats();
+
+    void init() override;
+    void deinit() override;
+    void select(bool setSelected) override;
+    void write_Bytes(bool isData, const uint8_t *data, size_t len) override;
+    void read_Bytes(uint8_t *data, size_t len, uint8_t dummyBits) override;
+    void set_PixelBits(uint8_t bits) override;
+    bool start_Pixels(int dmaChannel, const uint16_t *src, uint32_t count, bool increment) override;
+    void wait_Bus() override;
+    uint32_t get_MaxPixels() const override;
+};
+
+}
+
+#endif
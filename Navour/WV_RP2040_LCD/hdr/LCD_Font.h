@@ -0,0 +1,244 @@
+#ifndef _WV_RP_2040_LCD_FONT_HEADER_
+#define _WV_RP_2040_LCD_FONT_HEADER_
+
+#include <stdint.h>
+
+/** \file WV_RP2040_LCD/LCD_Font.h
+ *  \headerfile LCD_Font.h
+ *  \defgroup WV_RP2040_LCD_Font WV_RP2040_LCD_Font api holds the text font of the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Pre-rasterized glyph atlases for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The base font is the classic 5x8 ASCII font, stored column wise. At compile time it is
+ *  turned into row wise atlases for the integer scales 1x, 2x and 3x: every glyph row is a
+ *  bitmask of the already widened pixels, so the text renderer expands a row of a whole
+ *  text line with one bit test per pixel and repeats it scale times vertically.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Font
+ *
+ *  \include LCD_Font.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Font First Char [' ']
+*  \brief Value
+*  \details First character held by the font.
+*  \ingroup WV_RP2040_LCD_Font
+*/
+#define WV_RP2040_LCD_FONT_FIRST 0x20 // First character of the font
+
+/*! \def WV RP2040 LCD Font Glyphs [95]
+*  \brief Value
+*  \details Number of glyphs held by the font, printable ASCII.
+*  \ingroup WV_RP2040_LCD_Font
+*/
+#define WV_RP2040_LCD_FONT_GLYPHS 95 // Glyphs in the font
+
+/*! \def WV RP2040 LCD Font Width [5]
+*  \brief Value
+*  \details Width of an unscaled glyph, an extra column separates two glyphs.
+*  \ingroup WV_RP2040_LCD_Font
+*/
+#define WV_RP2040_LCD_FONT_WIDTH 5 // Glyph width at 1x
+
+/*! \def WV RP2040 LCD Font Height [8]
+*  \brief Value
+*  \details Height of an unscaled glyph.
+*  \ingroup WV_RP2040_LCD_Font
+*/
+#define WV_RP2040_LCD_FONT_HEIGHT 8 // Glyph height at 1x
+
+/*! \def WV RP2040 LCD Font Max Scale [3]
+*  \brief Value
+*  \details Largest integer scale with a pre-rasterized atlas.
+*  \ingroup WV_RP2040_LCD_Font
+*/
+#define WV_RP2040_LCD_FONT_MAX_SCALE 3 // Largest atlas scale
+
+/*! \brief WV RP2040 LCD Font 5x8
+*   \ingroup WV_RP2040_LCD_Font
+*
+*   Base font, 5 columns per glyph, bit 0 is the top row.
+*/
+inline constexpr uint8_t WV_RP2040_LCD_FONT_5X8[WV_RP2040_LCD_FONT_GLYPHS * WV_RP2040_LCD_FONT_WIDTH] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, // ' '
+    0x00, 0x00, 0x5F, 0x00, 0x00, // '!'
+    0x00, 0x07, 0x00, 0x07, 0x00, // '"'
+    0x14, 0x7F, 0x14, 0x7F, 0x14, // '#'
+    0x24, 0x2A, 0x7F, 0x2A, 0x12, // '$'
+    0x23, 0x13, 0x08, 0x64, 0x62, // '%'
+    0x36, 0x49, 0x55, 0x22, 0x50, // '&'
+    0x00, 0x05, 0x03, 0x00, 0x00, // '''
+    0x00, 0x1C, 0x22, 0x41, 0x00, // '('
+    0x00, 0x41, 0x22, 0x1C, 0x00, // ')'
+    0x14, 0x08, 0x3E, 0x08, 0x14, // '*'
+    0x08, 0x08, 0x3E, 0x08, 0x08, // '+'
+    0x00, 0x50, 0x30, 0x00, 0x00, // ','
+    0x08, 0x08, 0x08, 0x08, 0x08, // '-'
+    0x00, 0x60, 0x60, 0x00, 0x00, // '.'
+    0x20, 0x10, 0x08, 0x04, 0x02, // '/'
+    0x3E, 0x51, 0x49, 0x45, 0x3E, // '0'
+    0x00, 0x42, 0x7F, 0x40, 0x00, // '1'
+    0x42, 0x61, 0x51, 0x49, 0x46, // '2'
+    0x21, 0x41, 0x45, 0x4B, 0x31, // '3'
+    0x18, 0x14, 0x12, 0x7F, 0x10, // '4'
+    0x27, 0x45, 0x45, 0x45, 0x39, // '5'
+    0x3C, 0x4A, 0x49, 0x49, 0x30, // '6'
+    0x01, 0x71, 0x09, 0x05, 0x03, // '7'
+    0x36, 0x49, 0x49, 0x49, 0x36, // '8'
+    0x06, 0x49, 0x49, 0x29, 0x1E, // '9'
+    0x00, 0x36, 0x36, 0x00, 0x00, // ':'
+    0x00, 0x56, 0x36, 0x00, 0x00, // ';'
+    0x08, 0x14, 0x22, 0x41, 0x00, // '<'
+    0x14, 0x14, 0x14, 0x14, 0x14, // '='
+    0x00, 0x41, 0x22, 0x14, 0x08, // '>'
+    0x02, 0x01, 0x51, 0x09, 0x06, // '?'
+    0x32, 0x49, 0x79, 0x41, 0x3E, // '@'
+    0x7E, 0x11, 0x11, 0x11, 0x7E, // 'A'
+    0x7F, 0x49, 0x49, 0x49, 0x36, // 'B'
+    0x3E, 0x41, 0x41, 0x41, 0x22, // 'C'
+    0x7F, 0x41, 0x41, 0x22, 0x1C, // 'D'
+    0x7F, 0x49, 0x49, 0x49, 0x41, // 'E'
+    0x7F, 0x09, 0x09, 0x09, 0x01, // 'F'
+    0x3E, 0x41, 0x49, 0x49, 0x7A, // 'G'
+    0x7F, 0x08, 0x08, 0x08, 0x7F, // 'H'
+    0x00, 0x41, 0x7F, 0x41, 0x00, // 'I'
+    0x20, 0x40, 0x41, 0x3F, 0x01, // 'J'
+    0x7F, 0x08, 0x14, 0x22, 0x41, // 'K'
+    0x7F, 0x40, 0x40, 0x40, 0x40, // 'L'
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, // 'M'
+    0x7F, 0x04, 0x08, 0x10, 0x7F, // 'N'
+    0x3E, 0x41, 0x41, 0x41, 0x3E, // 'O'
+    0x7F, 0x09, 0x09, 0x09, 0x06, // 'P'
+    0x3E, 0x41, 0x51, 0x21, 0x5E, // 'Q'
+    0x7F, 0x09, 0x19, 0x29, 0x46, // 'R'
+    0x46, 0x49, 0x49, 0x49, 0x31, // 'S'
+    0x01, 0x01, 0x7F, 0x01, 0x01, // 'T'
+    0x3F, 0x40, 0x40, 0x40, 0x3F, // 'U'
+    0x1F, 0x20, 0x40, 0x20, 0x1F, // 'V'
+    0x3F, 0x40, 0x38, 0x40, 0x3F, // 'W'
+    0x63, 0x14, 0x08, 0x14, 0x63, // 'X'
+    0x07, 0x08, 0x70, 0x08, 0x07, // 'Y'
+    0x61, 0x51, 0x49, 0x45, 0x43, // 'Z'
+    0x00, 0x7F, 0x41, 0x41, 0x00, // '['
+    0x02, 0x04, 0x08, 0x10, 0x20, // '\'
+    0x00, 0x41, 0x41, 0x7F, 0x00, // ']'
+    0x04, 0x02, 0x01, 0x02, 0x04, // '^'
+    0x40, 0x40, 0x40, 0x40, 0x40, // '_'
+    0x00, 0x01, 0x02, 0x04, 0x00, // '`'
+    0x20, 0x54, 0x54, 0x54, 0x78, // 'a'
+    0x7F, 0x48, 0x44, 0x44, 0x38, // 'b'
+    0x38, 0x44, 0x44, 0x44, 0x20, // 'c'
+    0x38, 0x44, 0x44, 0x48, 0x7F, // 'd'
+    0x38, 0x54, 0x54, 0x54, 0x18, // 'e'
+    0x08, 0x7E, 0x09, 0x01, 0x02, // 'f'
+    0x0C, 0x52, 0x52, 0x52, 0x3E, // 'g'
+    0x7F, 0x08, 0x04, 0x04, 0x78, // 'h'
+    0x00, 0x44, 0x7D, 0x40, 0x00, // 'i'
+    0x20, 0x40, 0x44, 0x3D, 0x00, // 'j'
+    0x7F, 0x10, 0x28, 0x44, 0x00, // 'k'
+    0x00, 0x41, 0x7F, 0x40, 0x00, // 'l'
+    0x7C, 0x04, 0x18, 0x04, 0x78, // 'm'
+    0x7C, 0x08, 0x04, 0x04, 0x78, // 'n'
+    0x38, 0x44, 0x44, 0x44, 0x38, // 'o'
+    0x7C, 0x14, 0x14, 0x14, 0x08, // 'p'
+    0x08, 0x14, 0x14, 0x18, 0x7C, // 'q'
+    0x7C, 0x08, 0x04, 0x04, 0x08, // 'r'
+    0x48, 0x54, 0x54, 0x54, 0x20, // 's'
+    0x04, 0x3F, 0x44, 0x40, 0x20, // 't'
+    0x3C, 0x40, 0x40, 0x20, 0x7C, // 'u'
+    0x1C, 0x20, 0x40, 0x20, 0x1C, // 'v'
+    0x3C, 0x40, 0x30, 0x40, 0x3C, // 'w'
+    0x44, 0x28, 0x10, 0x28, 0x44, // 'x'
+    0x0C, 0x50, 0x50, 0x50, 0x3C, // 'y'
+    0x44, 0x64, 0x54, 0x4C, 0x44, // 'z'
+    0x00, 0x08, 0x36, 0x41, 0x00, // '{'
+    0x00, 0x00, 0x7F, 0x00, 0x00, // '|'
+    0x00, 0x41, 0x36, 0x08, 0x00, // '}'
+    0x08, 0x04, 0x08, 0x10, 0x08, // '~'
+};
+
+/*! \class WV_RP2040_LCD_GlyphAtlas
+ *  \ingroup WV_RP2040_LCD_Font
+ *  \brief WV_RP2040_LCD_GlyphAtlas class
+ *
+ *  Row wise glyph bitmaps at an integer scale, built at compile time. Bit
+ *  (width - 1 - x) of a row is the pixel at column x of the scaled glyph.
+ */
+class WV_RP2040_LCD_GlyphAtlas
+{
+public:
+    uint8_t scale;      /*!< Integer scale of the atlas */
+    uint8_t width;      /*!< Scaled glyph width in pixels */
+    uint8_t height;     /*!< Scaled glyph height in pixels */
+    uint8_t advance;    /*!< Scaled distance between two glyphs in pixels */
+    uint16_t rows[WV_RP2040_LCD_FONT_GLYPHS][WV_RP2040_LCD_FONT_HEIGHT] = {}; /*!< Widened rows, repeat each scale times */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Font
+    *
+    *  Rasterizes the base font at the given scale.
+    *
+    *  \param atlasScale The integer scale, 1 - WV_RP2040_LCD_FONT_MAX_SCALE.
+    */
+    constexpr WV_RP2040_LCD_GlyphAtlas(uint8_t atlasScale) :
+        scale(atlasScale), width(WV_RP2040_LCD_FONT_WIDTH * atlasScale),
+        height(WV_RP2040_LCD_FONT_HEIGHT * atlasScale), advance((WV_RP2040_LCD_FONT_WIDTH + 1) * atlasScale) {
+        for (uint16_t g = 0; g < WV_RP2040_LCD_FONT_GLYPHS; g++) {
+            for (uint8_t y = 0; y < WV_RP2040_LCD_FONT_HEIGHT; y++) {
+                uint16_t row = 0;
+                for (uint8_t x = 0; x < WV_RP2040_LCD_FONT_WIDTH; x++) {
+                    bool isSet = (WV_RP2040_LCD_FONT_5X8[g * WV_RP2040_LCD_FONT_WIDTH + x] >> y) & 1;
+                    for (uint8_t s = 0; s < atlasScale; s++) row = (row << 1) | (isSet ? 1 : 0);
+                }
+                rows[g][y] = row;
+            }
+        }
+    }
+
+    /*! \brief Get Glyph
+    *  \ingroup WV_RP2040_LCD_Font
+    *
+    *  \param c The character, characters outside the font map to '?'.
+    *  \return Index of the glyph of the character.
+    */
+    static constexpr uint8_t get_Glyph(char c) {
+        return ((uint8_t)c < WV_RP2040_LCD_FONT_FIRST || (uint8_t)c >= WV_RP2040_LCD_FONT_FIRST + WV_RP2040_LCD_FONT_GLYPHS) ?
+            '?' - WV_RP2040_LCD_FONT_FIRST : (uint8_t)c - WV_RP2040_LCD_FONT_FIRST;
+    }
+};
+
+static_assert(WV_RP2040_LCD_FONT_WIDTH * WV_RP2040_LCD_FONT_MAX_SCALE <= 16, "Scaled glyph rows must fit 16 bits");
+
+/*! \brief WV RP2040 LCD Font Atlases
+*   \ingroup WV_RP2040_LCD_Font
+*
+*   The pre-rasterized atlases, in flash.
+*/
+inline constexpr WV_RP2040_LCD_GlyphAtlas WV_RP2040_LCD_FONT_1X(1);
+inline constexpr WV_RP2040_LCD_GlyphAtlas WV_RP2040_LCD_FONT_2X(2);
+inline constexpr WV_RP2040_LCD_GlyphAtlas WV_RP2040_LCD_FONT_3X(3);
+
+/*! \brief Get Font Atlas
+*   \ingroup WV_RP2040_LCD_Font
+*
+*   \category Global Function
+*
+*   \param scale The integer scale, clamped to 1 - WV_RP2040_LCD_FONT_MAX_SCALE.
+*   \return The atlas of the scale.
+*/
+constexpr const WV_RP2040_LCD_GlyphAtlas & get_FontAtlas(uint8_t scale) {
+    return (scale >= 3) ? WV_RP2040_LCD_FONT_3X : (scale == 2) ? WV_RP2040_LCD_FONT_2X : WV_RP2040_LCD_FONT_1X;
+}
+
+}
+
+#endif
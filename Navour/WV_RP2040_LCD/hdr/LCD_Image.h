@@ -0,0 +1,139 @@
+#ifndef _WV_RP_2040_LCD_IMAGE_HEADER_
+#define _WV_RP_2040_LCD_IMAGE_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** \file WV_RP2040_LCD/LCD_Image.h
+ *  \headerfile LCD_Image.h
+ *  \defgroup WV_RP2040_LCD_Image WV_RP2040_LCD_Image api holds compressed images for the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Run length encoded RGB565 images for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  Images are converted on the host by NavourAssets into a header holding a const
+ *  WV_RP2040_LCD_IMAGE, so they stay in flash and are read through XIP. The pixels are
+ *  a stream of packets, rows left to right, top to bottom:
+ *
+ *  \code
+ *  1nnnnnnn c0 c1              n + 1 pixels of the color c0 | c1 << 8
+ *  0nnnnnnn c0 c1 c0 c1 ...    n + 1 pixels, each c0 | c1 << 8
+ *  \endcode
+ *
+ *  A packet never crosses a row. WV_RP2040_LCD::draw_Image() decodes the stream
+ *  straight into the DMA line buffers, only the packet being read is ever held in RAM.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Image
+ *
+ *  \include LCD_Image.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Image Max Packet [128]
+*  \brief Value
+*  \details Pixels in one packet of the stream.
+*  \ingroup WV_RP2040_LCD_Image
+*/
+#define WV_RP2040_LCD_IMAGE_MAX_PACKET 128 // Pixels per packet
+
+/*! \def WV RP2040 LCD Image Run Flag [0x80]
+*  \brief Value
+*  \details Packet header bit of a run of one color, cleared for literal pixels.
+*  \ingroup WV_RP2040_LCD_Image
+*/
+#define WV_RP2040_LCD_IMAGE_RUN 0x80 // Run packet flag
+
+/*! \brief WV RP2040 LCD Image
+*   \ingroup WV_RP2040_LCD_Image
+*
+*   A compressed image, as written by NavourAssets.
+*/
+typedef struct _WV_RP2040_LCD_IMAGE_ {
+    uint16_t width;         //columns
+    uint16_t height;        //rows
+    bool isKeyed;           //true if pixels of the key color are left untouched
+    uint16_t key;           //transparent RGB565 color
+    const uint8_t *data;    //packets
+    uint32_t size;          //bytes of data
+} WV_RP2040_LCD_IMAGE;
+
+/*! \class WV_RP2040_LCD_ImageReader
+ *  \ingroup WV_RP2040_LCD_Image
+ *  \brief WV_RP2040_LCD_ImageReader class
+ *
+ *  Decodes the packets of an image one pixel at a time.
+ */
+class WV_RP2040_LCD_ImageReader
+{
+private:
+    const uint8_t *src;     /*!< Next byte of the stream */
+    const uint8_t *end;     /*!< End of the stream */
+    uint8_t left;           /*!< Pixels left in the current packet */
+    bool isRun;             /*!< True if the current packet is a run */
+    uint16_t color;         /*!< Color of the current run */
+
+    /*! \brief Load Packet
+    *  \ingroup WV_RP2040_LCD_Image
+    *  \category Local Function
+    *
+    *  Reads the header of the next packet, and its color for a run.
+    *
+    *  \return False at the end of the stream.
+    */
+    inline bool load_Packet() {
+        if (src >= end) return false;
+        uint8_t h = *src++;
+        isRun = (h & WV_RP2040_LCD_IMAGE_RUN) != 0;
+        left = (h & (WV_RP2040_LCD_IMAGE_RUN - 1)) + 1;
+        if (isRun) {
+            color = (uint16_t)(src[0] | (src[1] << 8));
+            src += 2;
+        }
+        return true;
+    }
+
+public:
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Image
+    *
+    *  \param img The image to be decoded, from its first pixel.
+    */
+    WV_RP2040_LCD_ImageReader(const WV_RP2040_LCD_IMAGE &img) :
+        src(img.data), end(img.data + img.size), left(0), isRun(false), color(0) {
+    }
+
+    /*! \brief Next
+    *  \ingroup WV_RP2040_LCD_Image
+    *
+    *  \return The next RGB565 pixel, 0 past the end of a truncated stream.
+    */
+    inline uint16_t next() {
+        if (!left && !load_Packet()) return 0;
+        left--;
+        if (isRun) return color;
+
+        uint16_t c = (uint16_t)(src[0] | (src[1] << 8));
+        src += 2;
+        return c;
+    }
+
+    /*! \brief Skip
+    *  \ingroup WV_RP2040_LCD_Image
+    *
+    *  Steps over pixels, whole packets are skipped by their header.
+    *
+    *  \param count The number of pixels.
+    */
+    void skip(uint32_t count);
+};
+
+}
+
+#endif
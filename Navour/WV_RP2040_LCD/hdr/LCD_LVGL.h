@@ -0,0 +1,210 @@
+#ifndef _WV_RP_2040_LCD_LVGL_HEADER_
+#define _WV_RP_2040_LCD_LVGL_HEADER_
+
+#include <stdint.h>
+
+#include "pico/stdlib.h"
+#include "lvgl.h"
+#include "WV_RP2040_LCD.h"
+
+/** \file WV_RP2040_LCD/LCD_LVGL.h
+ *  \headerfile LCD_LVGL.h
+ *  \defgroup WV_RP2040_LCD_LVGL WV_RP2040_LCD_LVGL api can be used to render LVGL on the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief LVGL display driver for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  Creates the lv_display of the LCD with two partial render buffers. A flushed area is
+ *  sent with a single address window through the DMA engine, and the display is told the
+ *  flush is ready from the transfer completion, so LVGL renders the next band into the
+ *  other buffer while the current one is clocked out.
+ *
+ *  Opaque fills and plain RGB565 images are taken by the draw unit of LCD_DrawUnit.h and
+ *  go to the panel without being rendered, rows of a band nothing else drew into are left
+ *  out of its flush.
+ *
+ *  Everything else is rendered by the software draw units, each one a thread of the
+ *  LV_OS_CUSTOM port of LCD_OS.h, one on core1 and one beside the main loop on core0.
+ *
+ *  The tick of LVGL is counted by a repeating timer alarm. run() only calls
+ *  lv_timer_handler once the time it asked for has passed or an area of the display
+ *  was invalidated, and sleeps the core in between, the alarm wakes it.
+ *
+ *  Typical main loop:
+ *  \code
+ *  auto& lcd = WV_RP2040::WV_RP2040_LCD::get_Inst();
+ *  lcd.initialize_LCD();
+ *  auto& ui = WV_RP2040::WV_RP2040_LCD_LVGL::get_Inst(); //calls lv_init() and creates the display
+ *
+ *  lv_obj_t *label = lv_label_create(lv_screen_active());
+ *  lv_timer_create(update_Label, 1000, label); //periodic work runs as LVGL timers
+ *
+ *  while (true) {
+ *      //sleeps until LVGL is due, then renders and flushes
+ *      ui.run();
+ *  }
+ *  \endcode
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_LVGL
+ *
+ *  \include LCD_LVGL.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD LVGL Buffer Divider [10]
+*  \brief Value
+*  \details Each of the two render buffers holds 1/n of the screen.
+*  \ingroup WV_RP2040_LCD_LVGL
+*/
+#ifndef WV_RP2040_LCD_LVGL_BUF_DIV
+#define WV_RP2040_LCD_LVGL_BUF_DIV 10 // Fraction of the screen per render buffer
+#endif
+
+/*! \def WV RP2040 LCD LVGL Buffer Pixels
+*  \brief Value
+*  \details Size of each of the two render buffers in pixels.
+*  \ingroup WV_RP2040_LCD_LVGL
+*/
+#define WV_RP2040_LCD_LVGL_BUF_PX ((WV_RP2040_LCD_WIDTH * WV_RP2040_LCD_HEIGHT) / WV_RP2040_LCD_LVGL_BUF_DIV)
+
+/*! \def WV RP2040 LCD LVGL Max Idle [33ms]
+*  \brief Value
+*  \details Upper bound of the idle time returned by handle_Timers().
+*  \ingroup WV_RP2040_LCD_LVGL
+*/
+#define WV_RP2040_LCD_LVGL_MAX_IDLE_MS LV_DEF_REFR_PERIOD // Longest sleep between two timer runs
+
+/*! \def WV RP2040 LCD LVGL Tick [1ms]
+*  \brief Value
+*  \details Period of the tick alarm, the granularity of the LVGL timers.
+*  \ingroup WV_RP2040_LCD_LVGL
+*/
+#ifndef WV_RP2040_LCD_LVGL_TICK_MS
+#define WV_RP2040_LCD_LVGL_TICK_MS 1 // Tick alarm period
+#endif
+
+/*! \class WV_RP2040_LCD_LVGL
+ *  \ingroup WV_RP2040_LCD_LVGL
+ *  \brief WV_RP2040_LCD_LVGL class
+ *
+ *  Singleton LVGL display driver of the on-board LCD.
+ */
+class WV_RP2040_LCD_LVGL
+{
+private:
+    lv_display_t *display; /*!< The LVGL display of the LCD */
+    repeating_timer_t tickTimer; /*!< Alarm counting the tick of LVGL */
+    volatile uint32_t dueIn; /*!< Ms until lv_timer_handler is due, LV_NO_TIMER_READY for never */
+    volatile bool isDue; /*!< Set once the handler is due or the display was invalidated */
+    bool isHandling; /*!< True while lv_timer_handler runs, its own invalidations are accounted for */
+
+    /*!< Partial render buffers, LVGL renders into one while the other is sent */
+    uint16_t drawBufs[2][WV_RP2040_LCD_LVGL_BUF_PX] __attribute__((aligned(LV_DRAW_BUF_ALIGN)));
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *  \category Local Function
+    *
+    *  Initializes LVGL if needed and creates the display.
+    */
+    WV_RP2040_LCD_LVGL();
+
+    WV_RP2040_LCD_LVGL( const WV_RP2040_LCD_LVGL & ) = delete;
+    WV_RP2040_LCD_LVGL& operator=( const WV_RP2040_LCD_LVGL & ) = delete;
+
+    /*! \brief Flush Callback
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *  \category Local Function
+    *
+    *  Queues the rendered area as one window write and a completion notification.
+    */
+    static void flush_CB(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+
+    /*! \brief Flush Done
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *  \category Local Function
+    *
+    *  Transfer completion of a flushed area, releases the render buffer back to LVGL.
+    */
+    static void flush_Done(void *ctx);
+
+    /*! \brief Tick Callback
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *  \category Local Function
+    *
+    *  Millisecond tick source of LVGL.
+    */
+    static uint32_t tick_CB();
+
+    /*! \brief Tick Alarm
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *  \category Local Function
+    *
+    *  Repeating timer callback, advances the tick of LVGL and counts down to the next
+    *  handler run.
+    */
+    static bool tick_Alarm(repeating_timer_t *rt);
+
+    /*! \brief Invalidate Callback
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *  \category Local Function
+    *
+    *  Display event of an invalidated area, makes the handler due right away.
+    */
+    static void invalidate_CB(lv_event_t *e);
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_LVGL & get_Inst();
+
+    /*! \brief Get Display
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *
+    *  \return The LVGL display of the LCD.
+    */
+    lv_display_t * get_Display() const;
+
+    /*! \brief Handle Timers
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *
+    *  Runs lv_timer_handler, which renders and flushes the invalidated areas, for loops
+    *  which sleep by themselves.
+    *
+    *  \return The time in ms until the handler should run again, capped to WV_RP2040_LCD_LVGL_MAX_IDLE_MS.
+    */
+    uint32_t handle_Timers();
+
+    /*! \brief Run
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *
+    *  Sleeps the core until lv_timer_handler is due, then runs it once. The handler is
+    *  due when the time it returned last has passed, when an area of the display was
+    *  invalidated since, or after request_Run().
+    */
+    void run();
+
+    /*! \brief Request Run
+    *  \ingroup WV_RP2040_LCD_LVGL
+    *
+    *  Makes the handler due right away, safe from interrupts and from the other core,
+    *  for producers which change what LVGL shows.
+    */
+    void request_Run();
+};
+
+}
+
+#endif
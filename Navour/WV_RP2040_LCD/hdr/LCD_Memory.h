@@ -0,0 +1,315 @@
+#ifndef _WV_RP_2040_LCD_MEMORY_HEADER_
+#define _WV_RP_2040_LCD_MEMORY_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+/** \file WV_RP2040_LCD/LCD_Memory.h
+ *  \headerfile LCD_Memory.h
+ *  \defgroup WV_RP2040_LCD_Memory WV_RP2040_LCD_Memory api is the heap of LVGL.
+ *  \author TheClownDev
+ *
+ *  \brief Pooled allocator behind lv_malloc() for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  lv_conf.h selects LV_STDLIB_CUSTOM, the LVGL memory hooks land here. Small requests,
+ *  which are most of them (style properties, widgets, draw tasks), are served from fixed
+ *  size classes of 16 to 256 bytes, each a free list over its own block array, so they
+ *  never fragment the rest of the heap. Larger requests, draw buffers and layers, and
+ *  requests of a full class go to a TLSF (two level segregated fit) arena, constant time
+ *  and good fits.
+ *
+ *  Live and peak bytes, the occupancy of every class and the fragmentation of the arena
+ *  are kept for get_Stats() and print(), so the block counts and the arena size can be
+ *  fitted to what the UI really uses.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Memory
+ *
+ *  \include LCD_Memory.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Memory Classes [5]
+*  \brief Value
+*  \details Size classes, 16, 32, 64, 128 and 256 bytes.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_CLASSES 5 // Size classes
+
+/*! \def WV RP2040 LCD Memory Min Class [16]
+*  \brief Value
+*  \details Block size of the smallest class, every next class doubles it.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_MIN_CLASS 16 // Bytes per block of class 0
+
+/*! \def WV RP2040 LCD Memory Blocks 16 [256]
+*  \brief Value
+*  \details Blocks of the 16 byte class, style properties and small arrays.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#ifndef WV_RP2040_LCD_MEM_BLOCKS_16
+#define WV_RP2040_LCD_MEM_BLOCKS_16 256 // 4 KB
+#endif
+
+/*! \def WV RP2040 LCD Memory Blocks 32 [192]
+*  \brief Value
+*  \details Blocks of the 32 byte class, styles and event descriptors.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#ifndef WV_RP2040_LCD_MEM_BLOCKS_32
+#define WV_RP2040_LCD_MEM_BLOCKS_32 192 // 6 KB
+#endif
+
+/*! \def WV RP2040 LCD Memory Blocks 64 [128]
+*  \brief Value
+*  \details Blocks of the 64 byte class, timers, animations and object specific data.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#ifndef WV_RP2040_LCD_MEM_BLOCKS_64
+#define WV_RP2040_LCD_MEM_BLOCKS_64 128 // 8 KB
+#endif
+
+/*! \def WV RP2040 LCD Memory Blocks 128 [64]
+*  \brief Value
+*  \details Blocks of the 128 byte class, widgets.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#ifndef WV_RP2040_LCD_MEM_BLOCKS_128
+#define WV_RP2040_LCD_MEM_BLOCKS_128 64 // 8 KB
+#endif
+
+/*! \def WV RP2040 LCD Memory Blocks 256 [16]
+*  \brief Value
+*  \details Blocks of the 256 byte class, larger widgets and draw tasks.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#ifndef WV_RP2040_LCD_MEM_BLOCKS_256
+#define WV_RP2040_LCD_MEM_BLOCKS_256 16 // 4 KB
+#endif
+
+/*! \def WV RP2040 LCD Memory Arena Size [34 KB]
+*  \brief Value
+*  \details Bytes of the TLSF arena, together with the classes the 64 KB LV_MEM_SIZE had before.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#ifndef WV_RP2040_LCD_MEM_ARENA_SIZE
+#define WV_RP2040_LCD_MEM_ARENA_SIZE (34 * 1024) // TLSF arena bytes
+#endif
+
+/*! \def WV RP2040 LCD Memory Second Level [8]
+*  \brief Value
+*  \details Free lists per power of two in the arena, as log2.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_SL_LOG2 3 // 8 lists per power of two
+
+/*! \def WV RP2040 LCD Memory First Level [16]
+*  \brief Value
+*  \details Powers of two of the arena, blocks from 64 bytes up to 2 MB.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_FL_COUNT 16 // First level lists
+
+/*! \brief WV RP2040 LCD Memory Class Stats
+*   \ingroup WV_RP2040_LCD_Memory
+*/
+typedef struct _WV_RP2040_LCD_MEM_CLASS_STATS_ {
+    uint16_t size;          //bytes per block
+    uint16_t blocks;        //blocks of the class
+    uint16_t used;          //blocks handed out
+    uint16_t peak;          //most blocks handed out at once
+    uint32_t overflows;     //requests sent to the arena as the class was full
+} WV_RP2040_LCD_MEM_CLASS_STATS;
+
+/*! \brief WV RP2040 LCD Memory Stats
+*   \ingroup WV_RP2040_LCD_Memory
+*/
+typedef struct _WV_RP2040_LCD_MEM_STATS_ {
+    uint32_t totalBytes;    //bytes of the classes and the arena
+    uint32_t liveBytes;     //bytes handed out, whole blocks
+    uint32_t peakBytes;     //most bytes handed out at once
+    uint32_t failures;      //requests which could not be served
+    uint32_t arenaFree;     //free bytes of the arena
+    uint32_t arenaBiggest;  //biggest free block of the arena
+    uint16_t arenaFreeBlocks;   //free blocks of the arena
+    uint16_t arenaUsedBlocks;   //used blocks of the arena
+    uint8_t fragmentation;  //percent of the free arena not in its biggest block
+    WV_RP2040_LCD_MEM_CLASS_STATS classes[WV_RP2040_LCD_MEM_CLASSES];
+} WV_RP2040_LCD_MEM_STATS;
+
+/*! \class WV_RP2040_LCD_Memory
+ *  \ingroup WV_RP2040_LCD_Memory
+ *  \brief WV_RP2040_LCD_Memory class
+ *
+ *  Singleton heap of LVGL, safe from both cores.
+ */
+class WV_RP2040_LCD_Memory
+{
+private:
+    /*! \brief WV RP2040 LCD Memory Block
+    *   \ingroup WV_RP2040_LCD_Memory
+    *
+    *   Header of an arena block, the free list links only exist in free blocks and
+    *   overlap the payload.
+    */
+    typedef struct _WV_RP2040_LCD_MEM_BLOCK_ {
+        struct _WV_RP2040_LCD_MEM_BLOCK_ *prevPhys; /*!< Block before this one in memory, NULL for the first */
+        uint32_t size;      /*!< Payload bytes, bit 0 set while free */
+        struct _WV_RP2040_LCD_MEM_BLOCK_ *nextFree; /*!< Next block of the free list */
+        struct _WV_RP2040_LCD_MEM_BLOCK_ *prevFree; /*!< Previous block of the free list */
+    } WV_RP2040_LCD_MEM_BLOCK;
+
+    void *classFree[WV_RP2040_LCD_MEM_CLASSES];     /*!< Free list of every class */
+    uint8_t *classBase[WV_RP2040_LCD_MEM_CLASSES];  /*!< First block of every class */
+    WV_RP2040_LCD_MEM_CLASS_STATS classStats[WV_RP2040_LCD_MEM_CLASSES]; /*!< Occupancy of every class */
+
+    uint32_t flMap;     /*!< First level lists holding blocks */
+    uint32_t slMap[WV_RP2040_LCD_MEM_FL_COUNT];     /*!< Second level lists holding blocks */
+    WV_RP2040_LCD_MEM_BLOCK *heads[WV_RP2040_LCD_MEM_FL_COUNT][1 << WV_RP2040_LCD_MEM_SL_LOG2]; /*!< Free lists */
+
+    uint32_t liveBytes;     /*!< Bytes handed out */
+    uint32_t peakBytes;     /*!< Most bytes handed out at once */
+    uint32_t failures;      /*!< Requests which could not be served */
+    spin_lock_t *lock;      /*!< Hardware spin lock, LVGL may run on both cores */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Memory
+    *  \category Local Function
+    *
+    *  Claims the spin lock and lays out the classes and the arena.
+    */
+    WV_RP2040_LCD_Memory();
+
+    WV_RP2040_LCD_Memory( const WV_RP2040_LCD_Memory & ) = delete;
+    WV_RP2040_LCD_Memory& operator=( const WV_RP2040_LCD_Memory & ) = delete;
+
+    /*! \brief Get Class
+    *  \ingroup WV_RP2040_LCD_Memory
+    *  \category Local Function
+    *
+    *  \return The class a pointer was handed out from, -1 for the arena.
+    */
+    int8_t get_Class(const void *p) const;
+
+    /*! \brief Insert Free
+    *  \ingroup WV_RP2040_LCD_Memory
+    *  \category Local Function
+    *
+    *  Marks an arena block free and puts it on the list of its size.
+    */
+    void insert_Free(WV_RP2040_LCD_MEM_BLOCK *b);
+
+    /*! \brief Remove Free
+    *  \ingroup WV_RP2040_LCD_Memory
+    *  \category Local Function
+    *
+    *  Takes an arena block off its free list and marks it used.
+    */
+    void remove_Free(WV_RP2040_LCD_MEM_BLOCK *b);
+
+    /*! \brief Arena Alloc
+    *  \ingroup WV_RP2040_LCD_Memory
+    *  \category Local Function
+    *
+    *  Good fit from the arena in constant time, the rest of the block is split off.
+    */
+    void * arena_Alloc(size_t size);
+
+    /*! \brief Arena Free
+    *  \ingroup WV_RP2040_LCD_Memory
+    *  \category Local Function
+    *
+    *  Returns a block to the arena, merged with free neighbours.
+    */
+    void arena_Free(void *p);
+
+    /*! \brief Get Usable
+    *  \ingroup WV_RP2040_LCD_Memory
+    *  \category Local Function
+    *
+    *  \return The bytes a handed out pointer may use.
+    */
+    uint32_t get_Usable(const void *p) const;
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_Memory
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_Memory & get_Inst();
+
+    /*! \brief Reset
+    *  \ingroup WV_RP2040_LCD_Memory
+    *
+    *  Drops every allocation and the statistics, lv_mem_init() and lv_mem_deinit().
+    */
+    void reset();
+
+    /*! \brief Alloc
+    *  \ingroup WV_RP2040_LCD_Memory
+    *
+    *  \param size The bytes needed.
+    *  \return 8 byte aligned memory, NULL if neither a class nor the arena has room.
+    */
+    void * alloc(size_t size);
+
+    /*! \brief Resize
+    *  \ingroup WV_RP2040_LCD_Memory
+    *
+    *  Keeps the block if it is big enough, moves the contents otherwise.
+    *
+    *  \param p The memory, NULL to allocate.
+    *  \param size The bytes needed.
+    *  \return The memory, NULL if there is no room, p stays valid then.
+    */
+    void * resize(void *p, size_t size);
+
+    /*! \brief Release
+    *  \ingroup WV_RP2040_LCD_Memory
+    *
+    *  \param p The memory, NULL is ignored.
+    */
+    void release(void *p);
+
+    /*! \brief Get Stats
+    *  \ingroup WV_RP2040_LCD_Memory
+    *
+    *  Walks the arena, its cost grows with the number of blocks.
+    *
+    *  \param stats Filled with the current usage.
+    */
+    void get_Stats(WV_RP2040_LCD_MEM_STATS &stats) const;
+
+    /*! \brief Check
+    *  \ingroup WV_RP2040_LCD_Memory
+    *
+    *  Verifies the links and sizes of every arena block and the class counters.
+    *
+    *  \return False if the heap is corrupted.
+    */
+    bool check() const;
+
+    /*! \brief Print
+    *  \ingroup WV_RP2040_LCD_Memory
+    *
+    *  Prints the usage over stdio, one line for the heap and one per class.
+    */
+    void print() const;
+};
+
+}
+
+#endif
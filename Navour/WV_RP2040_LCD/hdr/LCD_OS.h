@@ -0,0 +1,255 @@
+#ifndef _WV_RP_2040_LCD_OS_HEADER_
+#define _WV_RP_2040_LCD_OS_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "lvgl.h"
+
+/** \file WV_RP2040_LCD/LCD_OS.h
+ *  \headerfile LCD_OS.h
+ *  \defgroup WV_RP2040_LCD_OS WV_RP2040_LCD_OS api runs the LVGL threads on both cores.
+ *  \author TheClownDev
+ *
+ *  \brief LV_OS_CUSTOM port for the attached onboard LCD screen of WV_RP2040.
+ *
+ *  With an OS, LVGL runs every software draw unit in a thread of its own, the main loop
+ *  only creates and dispatches the draw tasks. There is no scheduler on the RP2040, so
+ *  the port places the threads itself:
+ *
+ *  - The first thread is started on core1 with pico_multicore, it renders in parallel
+ *    with everything core0 does.
+ *  - The second thread is a context of its own on core0, with its own stack. It runs
+ *    whenever the main loop waits for a draw task, and hands core0 back whenever it
+ *    waits itself, so core0 renders instead of idling.
+ *
+ *  Mutexes and events are flags guarded by a hardware spin lock, waiting cores sleep in
+ *  WFE and are woken by the SEV of the signal. The core0 contexts never preempt each
+ *  other, they switch only where one of them waits.
+ *
+ *  set_Parallel(false) lets only one render thread work at a time, so the benefit of
+ *  the second unit can be measured in the same build.
+ *
+ *  Core1 is claimed through WV_RP2040_LCD::claim_Core1() and belongs to LVGL once the
+ *  first thread is started, WV_RP2040_LCD_DisplayList::start() refuses from then on. If
+ *  the display list was started first, no thread is started at all. To use the display
+ *  list next to LVGL, LV_USE_OS has to be LV_OS_NONE in lv_conf.h.
+ *
+ *  The hooks in LCD_Port.cpp follow the lv_os.h of LVGL v9.3.0, where lv_thread_init()
+ *  takes the name of the thread.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_OS
+ *
+ *  \include LCD_OS.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD OS Threads [2]
+*  \brief Value
+*  \details Threads the port can run, one on core1 and one beside the main loop on core0.
+*  \ingroup WV_RP2040_LCD_OS
+*/
+#define WV_RP2040_LCD_OS_THREADS 2 // Render threads
+
+/*! \def WV RP2040 LCD OS Stack Words
+*  \brief Value
+*  \details Stack of each thread in words, LV_DRAW_THREAD_STACK_SIZE.
+*  \ingroup WV_RP2040_LCD_OS
+*/
+#define WV_RP2040_LCD_OS_STACK_WORDS (LV_DRAW_THREAD_STACK_SIZE / sizeof(uint32_t))
+
+/*! \class WV_RP2040_LCD_OS
+ *  \ingroup WV_RP2040_LCD_OS
+ *  \brief WV_RP2040_LCD_OS class
+ *
+ *  Singleton thread placement and synchronization behind the lv_thread, lv_mutex and
+ *  lv_thread_sync functions of LVGL.
+ */
+class WV_RP2040_LCD_OS
+{
+public:
+    /*! \brief WV RP2040 LCD OS Context
+    *   \ingroup WV_RP2040_LCD_OS
+    */
+    typedef enum _WV_RP2040_LCD_OS_CONTEXT_ {
+        CONTEXT_NONE = 0,   //nobody
+        CONTEXT_MAIN = 1,   //the main loop on core0
+        CONTEXT_CORE1 = 2,  //the thread on core1
+        CONTEXT_CORE0 = 3   //the thread beside the main loop on core0
+    } WV_RP2040_LCD_OS_CONTEXT;
+
+private:
+    spin_lock_t *lock;              /*!< Guards every mutex and event */
+    lv_thread_t *threads[WV_RP2040_LCD_OS_THREADS]; /*!< Started threads, core1 first */
+    uint8_t threadCount;            /*!< Started threads */
+    volatile bool isParallel;       /*!< False if only one render thread may work at a time */
+    volatile uint8_t renderOwner;   /*!< Render thread working while not parallel, 0 for none */
+    volatile uint32_t renderUs[WV_RP2040_LCD_OS_THREADS];  /*!< Time each thread spent working */
+    uint32_t renderStart[WV_RP2040_LCD_OS_THREADS];         /*!< Time each thread started working */
+    bool isWorking[WV_RP2040_LCD_OS_THREADS];               /*!< True between the waits of a thread */
+
+    bool isInCore0;                 /*!< True while the core0 thread runs */
+    bool isCore0Runnable;           /*!< True unless the core0 thread waits for an event */
+    lv_thread_sync_t *core0Wait;    /*!< Event the core0 thread waits for */
+    uint32_t *mainSp;               /*!< Saved stack pointer of the main loop */
+    uint32_t *core0Sp;              /*!< Saved stack pointer of the core0 thread */
+
+    /*!< Stacks of the threads */
+    uint32_t stacks[WV_RP2040_LCD_OS_THREADS][WV_RP2040_LCD_OS_STACK_WORDS] __attribute__((aligned(8)));
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_OS
+    *  \category Local Function
+    *
+    *  Claims the spin lock.
+    */
+    WV_RP2040_LCD_OS();
+
+    WV_RP2040_LCD_OS( const WV_RP2040_LCD_OS & ) = delete;
+    WV_RP2040_LCD_OS& operator=( const WV_RP2040_LCD_OS & ) = delete;
+
+    /*! \brief Core1 Entry
+    *  \ingroup WV_RP2040_LCD_OS
+    *  \category Local Function
+    */
+    static void core1_Entry();
+
+    /*! \brief Core0 Entry
+    *  \ingroup WV_RP2040_LCD_OS
+    *  \category Local Function
+    *
+    *  First code of the core0 thread, on its own stack.
+    */
+    static void core0_Entry();
+
+    /*! \brief Run Core0
+    *  \ingroup WV_RP2040_LCD_OS
+    *  \category Local Function
+    *
+    *  Switches the main loop to the core0 thread, returns once that waits.
+    */
+    void run_Core0();
+
+    /*! \brief Yield Core0
+    *  \ingroup WV_RP2040_LCD_OS
+    *  \category Local Function
+    *
+    *  Gives core0 to the other context, or sleeps until an event if that has nothing to do.
+    */
+    void yield_Core0();
+
+    /*! \brief Take Render
+    *  \ingroup WV_RP2040_LCD_OS
+    *  \category Local Function
+    *
+    *  While not parallel, waits until no other render thread works.
+    */
+    void take_Render(uint8_t ctx);
+
+    /*! \brief Give Render
+    *  \ingroup WV_RP2040_LCD_OS
+    *  \category Local Function
+    *
+    *  A render thread stops working, it is about to wait.
+    */
+    void give_Render(uint8_t ctx);
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_OS & get_Inst();
+
+    /*! \brief Get Context
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  \return The context calling.
+    */
+    WV_RP2040_LCD_OS_CONTEXT get_Context() const;
+
+    /*! \brief Start Thread
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  \param thread The thread, its callback and user_data set.
+    *  \param stackSize The stack the thread needs in bytes.
+    *  \return False if both places are taken, the stack is too small or core1 is claimed by another module.
+    */
+    bool start_Thread(lv_thread_t *thread, size_t stackSize);
+
+    /*! \brief Lock
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  Takes a mutex, nested locks of the owner are counted. An interrupt never nests, it
+    *  only gets a mutex nobody holds.
+    *
+    *  \param mutex The mutex.
+    *  \param isBlocking False to give up instead of waiting, for interrupts.
+    *  \return True if the mutex was taken.
+    */
+    bool lock_Mutex(lv_mutex_t *mutex, bool isBlocking);
+
+    /*! \brief Unlock
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  \param mutex The mutex, held by the caller.
+    */
+    void unlock_Mutex(lv_mutex_t *mutex);
+
+    /*! \brief Wait
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  Waits for an event and consumes it. The core0 contexts hand core0 to each other
+    *  meanwhile, core1 sleeps.
+    *
+    *  \param sync The event.
+    */
+    void wait_Sync(lv_thread_sync_t *sync);
+
+    /*! \brief Signal
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  Sets an event and wakes the waiting core, safe from interrupts.
+    *
+    *  \param sync The event.
+    */
+    void signal_Sync(lv_thread_sync_t *sync);
+
+    /*! \brief Set Parallel
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  \param setParallel False to let only one render thread work at a time.
+    */
+    void set_Parallel(bool setParallel);
+
+    /*! \brief Get Thread Count
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  \return The render threads started by LVGL.
+    */
+    uint8_t get_ThreadCount() const;
+
+    /*! \brief Get Render Us
+    *  \ingroup WV_RP2040_LCD_OS
+    *
+    *  \param index The thread, 0 for core1, 1 for core0.
+    *  \return The time in us the thread spent working since start up.
+    */
+    uint32_t get_RenderUs(uint8_t index) const;
+};
+
+}
+
+#endif
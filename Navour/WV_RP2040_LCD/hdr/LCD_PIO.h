@@ -0,0 +1,112 @@
+#ifndef _WV_RP_2040_LCD_PIO_HEADER_
+#define _WV_RP_2040_LCD_PIO_HEADER_
+
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+
+#include "LCD_Transport.h"
+
+/** \file WV_RP2040_LCD/LCD_PIO.h
+ *  \headerfile LCD_PIO.h
+ *  \defgroup WV_RP2040_LCD_PIO WV_RP2040_LCD_PIO api is the PIO transport of the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief PIO state machine backend of the attached onboard LCD screen of WV_RP2040.
+ *
+ *  A PIO state machine drives CLK, DIN and DC itself. Every burst is announced by a
+ *  header word carrying the DC level and the length, so commands, parameters and pixel
+ *  runs flow through the same FIFO in order, without the CPU waiting for the bus to
+ *  drain before a DC change. The bit clock is sys_clk / (2 * WV_RP2040_LCD_PIO_CLKDIV)
+ *  and is not bound to the clk_peri limit of the SPI peripheral.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_PIO
+ *
+ *  \include LCD_PIO.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD PIO Clock Divider [1.0]
+*  \brief Value
+*  \details State machine clock divider, each bit takes two state machine cycles.
+*  \ingroup WV_RP2040_LCD_PIO
+*/
+#ifndef WV_RP2040_LCD_PIO_CLKDIV
+#define WV_RP2040_LCD_PIO_CLKDIV 1.0f // PIO clock divider of the LCD transmitter
+#endif
+
+/*! \class WV_RP2040_LCD_PIO
+ *  \ingroup WV_RP2040_LCD_PIO
+ *  \brief WV_RP2040_LCD_PIO class
+ *
+ *  Singleton PIO transport.
+ */
+class WV_RP2040_LCD_PIO : public WV_RP2040_LCD_Transport
+{
+private:
+    PIO pio;        /*!< PIO block running the transmitter */
+    int sm;         /*!< Claimed state machine, -1 when not initialized */
+    uint offset;    /*!< Program offset in the instruction memory */
+    uint8_t pixelBits;  /*!< Unit size of the pixels, 16 or 12 */
+    bool isReading;     /*!< True while CLK and DIN are taken from the state machine for a read */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_PIO
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_PIO();
+
+    WV_RP2040_LCD_PIO( const WV_RP2040_LCD_PIO & ) = delete;
+    WV_RP2040_LCD_PIO& operator=( const WV_RP2040_LCD_PIO & ) = delete;
+
+    /*! \brief Put Header
+    *  \ingroup WV_RP2040_LCD_PIO
+    *  \category Local Function
+    *
+    *  Announces a burst to the state machine.
+    *
+    *  \param isData DC level of the burst.
+    *  \param unitBits Bits per unit, 4, 8, 12 or 16.
+    *  \param units Number of units, 1 - 65536.
+    *  \param isNibbleSkipped True to drop the top 4 bits of every halfword, for 12 bit pixels.
+    */
+    void put_Header(bool isData, uint8_t unitBits, uint32_t units, bool isNibbleSkipped = false);
+
+    /*! \brief Put Nibble
+    *  \ingroup WV_RP2040_LCD_PIO
+    *  \category Local Function
+    *
+    *  Queues a burst of one 4 bit unit.
+    */
+    void put_Nibble() override;
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_PIO
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_PIO & get_Inst();
+
+    void init() override;
+    void deinit() override;
+    void select(bool setSelected) override;
+    void write_Bytes(bool isData, const uint8_t *data, size_t len) override;
+    void read_Bytes(uint8_t *data, size_t len, uint8_t dummyBits) override;
+    void set_PixelBits(uint8_t bits) override;
+    bool start_Pixels(int dmaChannel, const uint16_t *src, uint32_t count, bool increment) override;
+    void wait_Bus() override;
+    uint32_t get_MaxPixels() const override;
+};
+
+}
+
+#endif
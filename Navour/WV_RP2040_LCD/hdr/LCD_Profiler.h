@@ -0,0 +1,277 @@
+#ifndef _WV_RP_2040_LCD_PROFILER_HEADER_
+#define _WV_RP_2040_LCD_PROFILER_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "pico/stdlib.h"
+
+/** \file WV_RP2040_LCD/LCD_Profiler.h
+ *  \headerfile LCD_Profiler.h
+ *  \defgroup WV_RP2040_LCD_Profiler WV_RP2040_LCD_Profiler api measures the bus traffic of the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Bus profiler of the attached onboard LCD screen of WV_RP2040.
+ *
+ *  Counts per primitive the calls, the bytes and transactions queued on the bus and the
+ *  time the caller was blocked waiting for the transfer engine. Frame markers turn the
+ *  counters into a rolling FPS and bus utilization summary, which can be queried or
+ *  printed over stdio.
+ *
+ *  Everything is behind WV_RP2040_LCD_PROFILE, the macros below expand to nothing when it
+ *  is 0 (the default), so a disabled profiler costs no code and no cycles. Enable it with
+ *  the WV_RP2040_LCD_PROFILE cmake option.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Profiler
+ *
+ *  \include LCD_Profiler.h
+*/
+
+/*! \def WV RP2040 LCD Profile [0]
+*  \brief Value
+*  \details 1 to build the profiler in, 0 to compile it out.
+*  \ingroup WV_RP2040_LCD_Profiler
+*/
+#ifndef WV_RP2040_LCD_PROFILE
+#define WV_RP2040_LCD_PROFILE 0 // Profiler disabled
+#endif
+
+/*! \def WV RP2040 LCD Profile Frames [16]
+*  \brief Value
+*  \details Number of frames the rolling summary covers.
+*  \ingroup WV_RP2040_LCD_Profiler
+*/
+#ifndef WV_RP2040_LCD_PROF_FRAMES
+#define WV_RP2040_LCD_PROF_FRAMES 16 // Frames in the rolling summary
+#endif
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \brief WV RP2040 LCD Profiler Primitive
+*   \ingroup WV_RP2040_LCD_Profiler
+*
+*   Draw call the traffic is accounted to, nested calls count for the outermost one.
+*/
+typedef enum _WV_RP2040_LCD_PROF_PRIM_ {
+    PROF_NONE           = 0, //traffic outside any instrumented call
+    PROF_COMMAND        = 1, //send_Command(), send_Data()
+    PROF_WINDOW         = 2, //set_Window()
+    PROF_PIXELS         = 3, //write_Pixels(), fill_Pixels()
+    PROF_RECT           = 4, //draw_Pixel(), draw_HLine(), draw_VLine(), draw_Rectangle(), clear_Screen()
+    PROF_LINE           = 5, //draw_Line()
+    PROF_ROUND          = 6, //circles and rounded rectangles
+    PROF_POLYGON        = 7, //triangles and polygons
+    PROF_TEXT           = 8, //draw_Char(), draw_String()
+    PROF_PRESENT        = 9, //present()
+    PROF_LVGL           = 10, //LVGL flushes
+    PROF_IMAGE          = 11, //draw_Image()
+    PROF_BLEND          = 12, //fill_RectAlpha(), draw_Mask()
+    PROF_PRIM_COUNT     = 13,
+} WV_RP2040_LCD_PROF_PRIM;
+
+/*! \brief WV RP2040 LCD Profiler Counters
+*   \ingroup WV_RP2040_LCD_Profiler
+*
+*   Counters of one primitive.
+*/
+typedef struct _WV_RP2040_LCD_PROF_COUNTERS_ {
+    uint32_t calls;         //outermost calls
+    uint32_t bytes;         //bytes queued on the bus
+    uint32_t transactions;  //jobs queued on the transfer engine
+    uint64_t blockedUs;     //time the caller waited for the engine
+} WV_RP2040_LCD_PROF_COUNTERS;
+
+/*! \brief WV RP2040 LCD Profiler Summary
+*   \ingroup WV_RP2040_LCD_Profiler
+*
+*   Rolling averages over the last frames.
+*/
+typedef struct _WV_RP2040_LCD_PROF_SUMMARY_ {
+    uint32_t frames;            //frames covered
+    float fps;                  //frames per second
+    float busUtilization;       //share of the frame time the bus was selected, 0 - 1
+    uint32_t bytesPerFrame;     //bytes queued per frame
+    uint32_t blockedUsPerFrame; //time blocked per frame
+} WV_RP2040_LCD_PROF_SUMMARY;
+
+#if WV_RP2040_LCD_PROFILE
+
+/*! \class WV_RP2040_LCD_Profiler
+ *  \ingroup WV_RP2040_LCD_Profiler
+ *  \brief WV_RP2040_LCD_Profiler class
+ *
+ *  Singleton holding the counters, fed by the macros below.
+ */
+class WV_RP2040_LCD_Profiler
+{
+private:
+    /*! \brief Frame Record
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  Totals of one finished frame.
+    */
+    typedef struct _WV_RP2040_LCD_PROF_FRAME_ {
+        uint64_t frameUs;
+        uint64_t busUs;
+        uint32_t bytes;
+        uint64_t blockedUs;
+    } WV_RP2040_LCD_PROF_FRAME;
+
+    WV_RP2040_LCD_PROF_COUNTERS counters[PROF_PRIM_COUNT]; /*!< Counters per primitive */
+    WV_RP2040_LCD_PROF_PRIM current;    /*!< Primitive the traffic goes to */
+    WV_RP2040_LCD_PROF_FRAME frames[WV_RP2040_LCD_PROF_FRAMES]; /*!< Ring of the last frames */
+    uint32_t frameCount;                /*!< Frames finished since the last reset */
+    WV_RP2040_LCD_PROF_FRAME frame;     /*!< Frame being measured */
+    uint64_t frameStartUs;              /*!< Start of the frame, 0 outside frames */
+    volatile uint64_t busUs;            /*!< Time the bus was selected, written from the interrupt */
+    uint64_t busStartUs;                /*!< Start of the current bus selection */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_Profiler();
+
+    WV_RP2040_LCD_Profiler( const WV_RP2040_LCD_Profiler & ) = delete;
+    WV_RP2040_LCD_Profiler& operator=( const WV_RP2040_LCD_Profiler & ) = delete;
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_Profiler & get_Inst();
+
+    /*! \brief Enter
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  Starts accounting to a primitive unless an outer one is already active.
+    *
+    *  \return The primitive to be restored by leave().
+    */
+    WV_RP2040_LCD_PROF_PRIM enter(WV_RP2040_LCD_PROF_PRIM prim);
+
+    /*! \brief Leave
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  \param prev The value returned by the matching enter().
+    */
+    void leave(WV_RP2040_LCD_PROF_PRIM prev);
+
+    /*! \brief Add Transaction
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  \param bytes The bytes the queued job puts on the bus.
+    */
+    void add_Transaction(uint32_t bytes);
+
+    /*! \brief Add Blocked
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  \param us The time the caller waited for the engine.
+    */
+    void add_Blocked(uint64_t us);
+
+    /*! \brief Set Bus
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  Marks the bus as selected or released, called by the transfer engine.
+    */
+    void set_Bus(bool isSelected);
+
+    /*! \brief Begin Frame
+    *  \ingroup WV_RP2040_LCD_Profiler
+    */
+    void begin_Frame();
+
+    /*! \brief End Frame
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  Closes the frame opened by begin_Frame() and adds it to the rolling summary.
+    */
+    void end_Frame();
+
+    /*! \brief Get Counters
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  \return The counters of a primitive since the last reset().
+    */
+    const WV_RP2040_LCD_PROF_COUNTERS & get_Counters(WV_RP2040_LCD_PROF_PRIM prim) const;
+
+    /*! \brief Get Summary
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  \param summary Filled with the averages over the last frames.
+    */
+    void get_Summary(WV_RP2040_LCD_PROF_SUMMARY &summary) const;
+
+    /*! \brief Print
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  Prints the summary and the counters of every primitive over stdio.
+    */
+    void print() const;
+
+    /*! \brief Reset
+    *  \ingroup WV_RP2040_LCD_Profiler
+    *
+    *  Clears the counters and the frame history.
+    */
+    void reset();
+};
+
+/*! \class WV_RP2040_LCD_ProfScope
+ *  \ingroup WV_RP2040_LCD_Profiler
+ *  \brief WV_RP2040_LCD_ProfScope class
+ *
+ *  Accounts the traffic of a block to a primitive, see WV_RP2040_LCD_PROF_SCOPE.
+ */
+class WV_RP2040_LCD_ProfScope
+{
+private:
+    WV_RP2040_LCD_PROF_PRIM prev; /*!< Primitive active before the block */
+
+public:
+    WV_RP2040_LCD_ProfScope(WV_RP2040_LCD_PROF_PRIM prim) : prev(WV_RP2040_LCD_Profiler::get_Inst().enter(prim)) {}
+    ~WV_RP2040_LCD_ProfScope() { WV_RP2040_LCD_Profiler::get_Inst().leave(prev); }
+};
+
+/*! \def WV RP2040 LCD Profiler Macros
+*  \brief Function
+*  \details Instrumentation points, empty when the profiler is compiled out.
+*  \ingroup WV_RP2040_LCD_Profiler
+*/
+#define WV_RP2040_LCD_PROF_SCOPE(prim) WV_RP2040::WV_RP2040_LCD_ProfScope __profScope(WV_RP2040::prim)
+#define WV_RP2040_LCD_PROF_TRANSACTION(bytes) WV_RP2040::WV_RP2040_LCD_Profiler::get_Inst().add_Transaction(bytes)
+#define WV_RP2040_LCD_PROF_BLOCK_BEGIN() uint64_t __profBlockUs = time_us_64()
+#define WV_RP2040_LCD_PROF_BLOCK_END() WV_RP2040::WV_RP2040_LCD_Profiler::get_Inst().add_Blocked(time_us_64() - __profBlockUs)
+#define WV_RP2040_LCD_PROF_BUS(isSelected) WV_RP2040::WV_RP2040_LCD_Profiler::get_Inst().set_Bus(isSelected)
+#define WV_RP2040_LCD_PROF_FRAME_BEGIN() WV_RP2040::WV_RP2040_LCD_Profiler::get_Inst().begin_Frame()
+#define WV_RP2040_LCD_PROF_FRAME_END() WV_RP2040::WV_RP2040_LCD_Profiler::get_Inst().end_Frame()
+#define WV_RP2040_LCD_PROF_PRINT() WV_RP2040::WV_RP2040_LCD_Profiler::get_Inst().print()
+
+#else
+
+#define WV_RP2040_LCD_PROF_SCOPE(prim) do {} while (0)
+#define WV_RP2040_LCD_PROF_TRANSACTION(bytes) do {} while (0)
+#define WV_RP2040_LCD_PROF_BLOCK_BEGIN() do {} while (0)
+#define WV_RP2040_LCD_PROF_BLOCK_END() do {} while (0)
+#define WV_RP2040_LCD_PROF_BUS(isSelected) do {} while (0)
+#define WV_RP2040_LCD_PROF_FRAME_BEGIN() do {} while (0)
+#define WV_RP2040_LCD_PROF_FRAME_END() do {} while (0)
+#define WV_RP2040_LCD_PROF_PRINT() do {} while (0)
+
+#endif
+
+}
+
+#endif
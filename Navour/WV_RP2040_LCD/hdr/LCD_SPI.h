@@ -0,0 +1,108 @@
+#ifndef _WV_RP_2040_LCD_SPI_HEADER_
+#define _WV_RP_2040_LCD_SPI_HEADER_
+
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+
+#include "LCD_Transport.h"
+
+/** \file WV_RP2040_LCD/LCD_SPI.h
+ *  \headerfile LCD_SPI.h
+ *  \defgroup WV_RP2040_LCD_SPI WV_RP2040_LCD_SPI api is the SPI peripheral transport of the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief SPI peripheral backend of the attached onboard LCD screen of WV_RP2040.
+ *
+ *  Drives the LCD with spi0. Command and data bytes are sent as 8 bit frames with the
+ *  DC pin toggled by the CPU, pixels as 16 bit frames fed by DMA.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_SPI
+ *
+ *  \include LCD_SPI.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD SPI Baudrate [62.5MHz]
+*  \brief Value
+*  \details SPI clock used to talk with the LCD.
+*  \ingroup WV_RP2040_LCD_SPI
+*/
+#define WV_RP2040_LCD_SPI_BAUD (62500 * 1000) // SPI clock of the attached LCD
+
+/*! \class WV_RP2040_LCD_SPI
+ *  \ingroup WV_RP2040_LCD_SPI
+ *  \brief WV_RP2040_LCD_SPI class
+ *
+ *  Singleton SPI peripheral transport.
+ */
+class WV_RP2040_LCD_SPI : public WV_RP2040_LCD_Transport
+{
+private:
+    spi_inst_t *spi;    /*!< SPI instance connected with the LCD */
+    uint8_t frameBits;  /*!< Current SPI frame size, 4, 8, 12 or 16 */
+    uint8_t pixelBits;  /*!< Frame size of the pixels, 16 or 12 */
+    bool isReading;     /*!< True while CLK and DIN are taken from the SPI for a read */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_SPI
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_SPI();
+
+    WV_RP2040_LCD_SPI( const WV_RP2040_LCD_SPI & ) = delete;
+    WV_RP2040_LCD_SPI& operator=( const WV_RP2040_LCD_SPI & ) = delete;
+
+    /*! \brief Set Frame Bits
+    *  \ingroup WV_RP2040_LCD_SPI
+    *  \category Local Function
+    *
+    *  Switches the SPI frame size once the bus is idle.
+    */
+    void set_FrameBits(uint8_t bits);
+
+    /*! \brief Put Nibble
+    *  \ingroup WV_RP2040_LCD_SPI
+    *  \category Local Function
+    *
+    *  Sends a 4 bit frame.
+    */
+    void put_Nibble() override;
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_SPI
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_SPI & get_Inst();
+
+    /*! \brief Get SPI
+    *  \ingroup WV_RP2040_LCD_SPI
+    *
+    *  \return The SPI instance connected with the LCD.
+    */
+    spi_inst_t * get_SPI() const;
+
+    void init() override;
+    void deinit() override;
+    void select(bool setSelected) override;
+    void write_Bytes(bool isData, const uint8_t *data, size_t len) override;
+    void read_Bytes(uint8_t *data, size_t len, uint8_t dummyBits) override;
+    void set_PixelBits(uint8_t bits) override;
+    bool start_Pixels(int dmaChannel, const uint16_t *src, uint32_t count, bool increment) override;
+    void wait_Bus() override;
+    uint32_t get_MaxPixels() const override;
+};
+
+}
+
+#endif
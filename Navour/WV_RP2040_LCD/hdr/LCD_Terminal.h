@@ -0,0 +1,175 @@
+#ifndef _WV_RP_2040_LCD_TERMINAL_HEADER_
+#define _WV_RP_2040_LCD_TERMINAL_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "WV_RP2040_LCD.h"
+
+/** \file WV_RP2040_LCD/LCD_Terminal.h
+ *  \headerfile LCD_Terminal.h
+ *  \defgroup WV_RP2040_LCD_Terminal WV_RP2040_LCD_Terminal api is a stdio terminal on the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Character cell terminal fed by stdio on the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The terminal registers itself as a stdio driver next to USB, so everything printed
+ *  with printf also shows up on the panel. Characters only go into a cell grid, the
+ *  panel is repainted on a line break, on stdio_flush() or once the time budget of a
+ *  partial line ran out, and only the cells which differ from what the panel shows are
+ *  sent. Scrolling moves the scroll start address of the controller, so a new line only
+ *  repaints its own cells.
+ *
+ *  Like WV_RP2040_LCD_Console the terminal writes to the controller directly, printf
+ *  must be called on the core driving the LCD while it is active.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Terminal
+ *
+ *  \include LCD_Terminal.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Terminal Columns [40]
+*  \brief Value
+*  \details Character cells per row.
+*  \ingroup WV_RP2040_LCD_Terminal
+*/
+#define WV_RP2040_LCD_TERM_COLS (WV_RP2040_LCD_WIDTH / (WV_RP2040_LCD_FONT_WIDTH + 1)) // Cells per row
+
+/*! \def WV RP2040 LCD Terminal Rows [30]
+*  \brief Value
+*  \details Character cell rows on the panel.
+*  \ingroup WV_RP2040_LCD_Terminal
+*/
+#define WV_RP2040_LCD_TERM_ROWS (WV_RP2040_LCD_HEIGHT / WV_RP2040_LCD_FONT_HEIGHT) // Cell rows
+
+/*! \def WV RP2040 LCD Terminal Slots [40]
+*  \brief Value
+*  \details Cell rows the frame memory holds, the rows below the panel are painted before they scroll in.
+*  \ingroup WV_RP2040_LCD_Terminal
+*/
+#define WV_RP2040_LCD_TERM_SLOTS (WV_RP2040_LCD_GRAM_HEIGHT / WV_RP2040_LCD_FONT_HEIGHT) // Cell rows in frame memory
+
+/*! \def WV RP2040 LCD Terminal Budget [20000]
+*  \brief Value
+*  \details Microseconds a partial line may wait for its line break before it is painted.
+*  \ingroup WV_RP2040_LCD_Terminal
+*/
+#define WV_RP2040_LCD_TERM_BUDGET_US 20000 // Max delay of a partial line
+
+/*! \class WV_RP2040_LCD_Terminal
+ *  \ingroup WV_RP2040_LCD_Terminal
+ *  \brief WV_RP2040_LCD_Terminal class
+ *
+ *  Singleton stdio terminal, call begin() once the LCD is initialized.
+ */
+class WV_RP2040_LCD_Terminal
+{
+private:
+    char cells[WV_RP2040_LCD_TERM_ROWS][WV_RP2040_LCD_TERM_COLS]; /*!< Cell grid, what should be shown */
+    char shown[WV_RP2040_LCD_TERM_SLOTS][WV_RP2040_LCD_TERM_COLS]; /*!< Cells as painted into the frame memory slots */
+    uint8_t curCol, curRow; /*!< Cursor */
+    uint8_t topSlot;        /*!< Frame memory slot of the top cell row */
+    uint8_t shownSlot;      /*!< Top slot the panel was last scrolled to */
+    uint16_t fg;            /*!< Text color */
+    uint16_t bg;            /*!< Background color */
+    uint64_t pendingSinceUs;/*!< Time the oldest unpainted cell was written, 0 if none */
+    bool isActive;          /*!< Flag to check if the terminal is registered */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_Terminal();
+
+    WV_RP2040_LCD_Terminal( const WV_RP2040_LCD_Terminal & ) = delete;
+    WV_RP2040_LCD_Terminal& operator=( const WV_RP2040_LCD_Terminal & ) = delete;
+
+    /*! \brief New Line
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *  \category Local Function
+    *
+    *  Moves the cursor to the next row, scrolls the grid up on the last row.
+    */
+    void new_Line();
+
+    /*! \brief Paint Cells
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *  \category Local Function
+    *
+    *  Sends a run of cells of a row in one window and marks them as shown.
+    */
+    void paint_Cells(uint8_t row, uint8_t col, uint8_t count);
+
+public:
+    /*! \brief Get Instance
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *
+    *  Singleton instance accessor.
+    *
+    *  \return Reference to the single instance of the class.
+    */
+    static WV_RP2040_LCD_Terminal & get_Inst();
+
+    /*! \brief Begin
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *
+    *  Clears the panel and registers the terminal as a stdio driver, the panel goes
+    *  back to ORIENT_0 as it scrolls along the frame memory rows.
+    *
+    *  \param setFg The text color.
+    *  \param setBg The background color.
+    */
+    void begin(uint16_t setFg, uint16_t setBg);
+
+    /*! \brief End
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *
+    *  Removes the stdio driver and returns the controller to the normal display mode.
+    */
+    void end();
+
+    /*! \brief Write
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *
+    *  Puts characters into the cell grid, '\n', '\r', '\t' and '\b' move the cursor.
+    *  The grid is painted on a line break or once the time budget ran out.
+    *
+    *  \param text The characters.
+    *  \param len The number of characters.
+    */
+    void write(const char *text, int len);
+
+    /*! \brief Flush
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *
+    *  Paints the cells which differ from the panel.
+    */
+    void flush();
+
+    /*! \brief Handle Pending
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *
+    *  Paints a partial line once its time budget ran out, call it from the main loop so
+    *  output without a line break shows up too.
+    */
+    void handle_Pending();
+
+    /*! \brief Is Active
+    *  \ingroup WV_RP2040_LCD_Terminal
+    *
+    *  \return True between begin() and end().
+    */
+    bool is_Active() const;
+};
+
+}
+
+#endif
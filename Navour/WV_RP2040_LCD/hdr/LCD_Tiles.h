@@ -0,0 +1,113 @@
+#ifndef _WV_RP_2040_LCD_TILES_HEADER_
+#define _WV_RP_2040_LCD_TILES_HEADER_
+
+#include <stdint.h>
+
+#include "WV_RP2040_LCD.h"
+
+/** \file WV_RP2040_LCD/LCD_Tiles.h
+ *  \headerfile LCD_Tiles.h
+ *  \defgroup WV_RP2040_LCD_Tiles WV_RP2040_LCD_Tiles api can be used to find the changed tiles of a framebuffer.
+ *  \author TheClownDev
+ *
+ *  \brief Per-tile content hashes of the framebuffer of the attached onboard LCD screen of WV_RP2040.
+ *
+ *  The framebuffer is split in square tiles. Each tile keeps a cheap checksum of its
+ *  content as of the last present, a tile only needs to be sent when its checksum changed.
+ *  This catches redraws with identical content and direct writes into the framebuffer,
+ *  which the damage tracking can not see.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Tiles
+ *
+ *  \include LCD_Tiles.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Tile Size [16]
+*  \brief Value
+*  \details Width and height of a framebuffer tile in pixels, must be even.
+*  \ingroup WV_RP2040_LCD_Tiles
+*/
+#ifndef WV_RP2040_LCD_TILE_SIZE
+#define WV_RP2040_LCD_TILE_SIZE 16 // Tile edge in pixels
+#endif
+
+/*! \def WV RP2040 LCD Tiles X
+*  \brief Value
+*  \details Number of tile columns.
+*  \ingroup WV_RP2040_LCD_Tiles
+*/
+#define WV_RP2040_LCD_TILES_X ((WV_RP2040_LCD_WIDTH + WV_RP2040_LCD_TILE_SIZE - 1) / WV_RP2040_LCD_TILE_SIZE)
+
+/*! \def WV RP2040 LCD Tiles Y
+*  \brief Value
+*  \details Number of tile rows.
+*  \ingroup WV_RP2040_LCD_Tiles
+*/
+#define WV_RP2040_LCD_TILES_Y ((WV_RP2040_LCD_HEIGHT + WV_RP2040_LCD_TILE_SIZE - 1) / WV_RP2040_LCD_TILE_SIZE)
+
+/*! \class WV_RP2040_LCD_Tiles
+ *  \ingroup WV_RP2040_LCD_Tiles
+ *  \brief WV_RP2040_LCD_Tiles class
+ *
+ *  Checksums of the tiles of a WV_RP2040_LCD_WIDTH x WV_RP2040_LCD_HEIGHT framebuffer.
+ */
+class WV_RP2040_LCD_Tiles
+{
+private:
+    uint32_t hashes[WV_RP2040_LCD_TILES_Y][WV_RP2040_LCD_TILES_X]; /*!< Checksum of each tile as of the last refresh */
+    bool isValid; /*!< False until the checksums describe what is on the LCD */
+
+    /*! \brief Hash Tile
+    *  \ingroup WV_RP2040_LCD_Tiles
+    *  \category Local Function
+    *
+    *  FNV-1a over the tile, two pixels per step.
+    *
+    *  \return The checksum of the tile.
+    */
+    static uint32_t hash_Tile(const uint16_t *fb, uint16_t tx, uint16_t ty);
+
+public:
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Tiles
+    */
+    WV_RP2040_LCD_Tiles();
+
+    /*! \brief Invalidate
+    *  \ingroup WV_RP2040_LCD_Tiles
+    *
+    *  Forgets the checksums, the next refresh reports every tile as changed.
+    */
+    void invalidate();
+
+    /*! \brief Refresh Row
+    *  \ingroup WV_RP2040_LCD_Tiles
+    *
+    *  Rehashes a row of tiles and reports which of them changed since the last refresh.
+    *
+    *  \param fb The framebuffer, hashed a word at a time when 4 byte aligned.
+    *  \param ty The tile row.
+    *  \param changed Receives WV_RP2040_LCD_TILES_X flags, true for every changed tile.
+    *  \return The number of changed tiles in the row.
+    */
+    uint16_t refresh_Row(const uint16_t *fb, uint16_t ty, bool *changed);
+
+    /*! \brief Mark Valid
+    *  \ingroup WV_RP2040_LCD_Tiles
+    *
+    *  Ends a refresh pass, must be called once all the rows have been refreshed.
+    */
+    void mark_Valid();
+};
+
+}
+
+#endif
@@ -0,0 +1,204 @@
+#ifndef _WV_RP_2040_LCD_TRANSPORT_HEADER_
+#define _WV_RP_2040_LCD_TRANSPORT_HEADER_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** \file WV_RP2040_LCD/LCD_Transport.h
+ *  \headerfile LCD_Transport.h
+ *  \defgroup WV_RP2040_LCD_Transport WV_RP2040_LCD_Transport api is the bus interface of the LCD.
+ *  \author TheClownDev
+ *
+ *  \brief Bus interface between the DMA transfer engine and the attached onboard LCD screen of WV_RP2040.
+ *
+ *  A transport moves command bytes, data bytes and pixel runs to the LCD. The transfer
+ *  engine drives exactly one transport at a time, it can be swapped while the engine
+ *  is idle, so the different backends can be compared on the same board.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_LCD_Transport
+ *
+ *  \include LCD_Transport.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040
+{
+
+/*! \def WV RP2040 LCD Read Half Cycles [40]
+*  \brief Value
+*  \details CPU cycles per half period of the read clock, the controller needs 150 ns per read cycle.
+*  \ingroup WV_RP2040_LCD_Transport
+*/
+#ifndef WV_RP2040_LCD_READ_HALF_CYCLES
+#define WV_RP2040_LCD_READ_HALF_CYCLES 40 // Half read clock period in CPU cycles
+#endif
+
+/*! \class WV_RP2040_LCD_Transport
+ *  \ingroup WV_RP2040_LCD_Transport
+ *  \brief WV_RP2040_LCD_Transport class
+ *
+ *  Interface implemented by the LCD bus backends.
+ */
+class WV_RP2040_LCD_Transport
+{
+protected:
+    bool isHalfByte;    /*!< True if the 12 bit pixels sent so far end in the middle of a byte */
+
+    /*! \brief Constructor
+    *  \ingroup WV_RP2040_LCD_Transport
+    *  \category Local Function
+    */
+    WV_RP2040_LCD_Transport() : isHalfByte(false) {}
+
+    /*! \brief Put Nibble
+    *  \ingroup WV_RP2040_LCD_Transport
+    *  \category Local Function
+    *
+    *  Queues 4 zero bits as data behind the pixels sent so far.
+    */
+    virtual void put_Nibble() = 0;
+
+    /*! \brief Count Pixels
+    *  \ingroup WV_RP2040_LCD_Transport
+    *  \category Local Function
+    *
+    *  Keeps track of the byte boundary, called for every run handed to start_Pixels().
+    *
+    *  \param bits The bits per pixel of the run.
+    *  \param count The number of pixels.
+    */
+    inline void count_Pixels(uint8_t bits, uint32_t count) {
+        if (bits == 12) isHalfByte = isHalfByte != (bool)(count & 1);
+    }
+
+    /*! \brief Pad Byte
+    *  \ingroup WV_RP2040_LCD_Transport
+    *  \category Local Function
+    *
+    *  Completes the last byte of an odd run of 12 bit pixels, called before the next
+    *  command or the release of the chip select.
+    *
+    *  \return True if a nibble was queued.
+    */
+    inline bool pad_Byte() {
+        if (!isHalfByte) return false;
+
+        // The controller latches whole bytes, the spare nibble is ignored
+        put_Nibble();
+        isHalfByte = false;
+        return true;
+    }
+
+    /*! \brief Clock In
+    *  \ingroup WV_RP2040_LCD_Transport
+    *  \category Local Function
+    *
+    *  Switches CLK and DIN to the CPU and clocks bytes in on DIN, which the controller
+    *  drives during the read phase of a command. The caller hands the pins back to its
+    *  peripheral once the chip select is released, the controller drives DIN until then.
+    *
+    *  \param data The bytes read, MSB first.
+    *  \param len The number of bytes.
+    *  \param dummyBits Clock cycles skipped before the first byte.
+    */
+    static void clock_In(uint8_t *data, size_t len, uint8_t dummyBits);
+
+public:
+    virtual ~WV_RP2040_LCD_Transport() {}
+
+    /*! \brief Init
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  Claims the hardware of the transport and routes the LCD pins to it.
+    */
+    virtual void init() = 0;
+
+    /*! \brief Deinit
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  Releases the hardware of the transport, the bus is idle when called.
+    */
+    virtual void deinit() = 0;
+
+    /*! \brief Select
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  Asserts or releases the chip select, the bus is idle when releasing.
+    *
+    *  \param setSelected True to assert, false to release.
+    */
+    virtual void select(bool setSelected) = 0;
+
+    /*! \brief Write Bytes
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  Sends a few command or data bytes, may block until they are queued on the bus.
+    *
+    *  \param isData True for data (DC high), false for command bytes (DC low).
+    *  \param data The bytes to be sent.
+    *  \param len The number of bytes.
+    */
+    virtual void write_Bytes(bool isData, const uint8_t *data, size_t len) = 0;
+
+    /*! \brief Read Bytes
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  Reads bytes following the last command, the chip select has to stay asserted from
+    *  the command on. The board has no MISO line, the controller answers on DIN. Repeated
+    *  calls continue the same read, only the first one passes dummy bits. The read ends
+    *  with select(false), no command can be sent before.
+    *
+    *  \param data The bytes read.
+    *  \param len The number of bytes.
+    *  \param dummyBits Clock cycles the controller wants before the first byte.
+    */
+    virtual void read_Bytes(uint8_t *data, size_t len, uint8_t dummyBits) = 0;
+
+    /*! \brief Set Pixel Bits
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  Selects the size of the pixels sent by start_Pixels(), 16 for RGB565 or 12 for
+    *  RGB444 held in the low bits of each halfword. 12 bit pixels go out back to back,
+    *  two in three bytes, a run of odd length is padded to a full byte before the next
+    *  command. Called while the bus is idle.
+    *
+    *  \param bits The bits per pixel, 16 or 12.
+    */
+    virtual void set_PixelBits(uint8_t bits) = 0;
+
+    /*! \brief Start Pixels
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  Starts sending count pixels as data on the given DMA channel, the channel
+    *  raises the engine completion interrupt once done.
+    *
+    *  \param dmaChannel The DMA channel of the engine.
+    *  \param src The pixels, or a single pixel if increment is false.
+    *  \param count The number of pixels, at most get_MaxPixels().
+    *  \param increment False to repeat the pixel at src count times.
+    *  \return True if the pixels were sent synchronously and no interrupt will follow.
+    */
+    virtual bool start_Pixels(int dmaChannel, const uint16_t *src, uint32_t count, bool increment) = 0;
+
+    /*! \brief Wait Bus
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  Waits until everything handed to the transport has been clocked out.
+    */
+    virtual void wait_Bus() = 0;
+
+    /*! \brief Get Max Pixels
+    *  \ingroup WV_RP2040_LCD_Transport
+    *
+    *  \return The largest pixel count a single start_Pixels() can take.
+    */
+    virtual uint32_t get_MaxPixels() const = 0;
+};
+
+}
+
+#endif
@@ -1,6 +1,15 @@
 #ifndef _WV_RP_2040_LCD_HEADER_
 #define _WV_RP_2040_LCD_HEADER_
 
+#include <stdint.h>
+#include <stddef.h>
+
+#include "LCD_DMA.h"
+#include "LCD_Color.h"
+#include "LCD_Damage.h"
+#include "LCD_Font.h"
+#include "LCD_Image.h"
+
 /** \file WV_RP2040_LCD/GPIO_Util.h
  *  \headerfile WV_RP_2040_LCD.h
  *  \defgroup WV_RP2040_LCD WV_RP2040_LCD api can be used to use GPIO functionality.
@@ -67,6 +76,142 @@ namespace WV_RP2040
 */
 #define WV_RP2040_LCD_DIN_PIN 11 // Data-In pin of the attached LCD
 
+/*! \def WV RP2040 LCD Panel Width [240]
+*  \brief Value
+*  \details Visible columns of the panel in its natural orientation, ORIENT_0.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_PANEL_WIDTH
+#define WV_RP2040_LCD_PANEL_WIDTH 240 // Columns of the attached LCD
+#endif
+
+/*! \def WV RP2040 LCD Panel Height [240]
+*  \brief Value
+*  \details Visible rows of the panel in its natural orientation, ORIENT_0.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_PANEL_HEIGHT
+#define WV_RP2040_LCD_PANEL_HEIGHT 240 // Rows of the attached LCD
+#endif
+
+/*! \def WV RP2040 LCD Panel Column Offset [0]
+*  \brief Value
+*  \details First frame memory column the panel shows in its natural orientation.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_PANEL_COL_OFFSET
+#define WV_RP2040_LCD_PANEL_COL_OFFSET 0 // Frame memory column of the panel
+#endif
+
+/*! \def WV RP2040 LCD Panel Row Offset [0]
+*  \brief Value
+*  \details First frame memory row the panel shows in its natural orientation.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_PANEL_ROW_OFFSET
+#define WV_RP2040_LCD_PANEL_ROW_OFFSET 0 // Frame memory row of the panel
+#endif
+
+/*! \def WV RP2040 LCD Rotation [0]
+*  \brief Value
+*  \details Quarter turns clockwise initialize_LCD() sets the panel up with, it fixes the logical size.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_ROTATION
+#define WV_RP2040_LCD_ROTATION 0 // Orientation at start up
+#endif
+
+/*! \def WV RP2040 LCD Width [240]
+*  \brief Value
+*  \details Width of the attached LCD in pixels, in logical coordinates.
+*  \ingroup WV_RP2040_LCD
+*/
+#define WV_RP2040_LCD_WIDTH ((WV_RP2040_LCD_ROTATION & 1) ? WV_RP2040_LCD_PANEL_HEIGHT : WV_RP2040_LCD_PANEL_WIDTH) // Width of the attached LCD
+
+/*! \def WV RP2040 LCD Height [240]
+*  \brief Value
+*  \details Height of the attached LCD in pixels, in logical coordinates.
+*  \ingroup WV_RP2040_LCD
+*/
+#define WV_RP2040_LCD_HEIGHT ((WV_RP2040_LCD_ROTATION & 1) ? WV_RP2040_LCD_PANEL_WIDTH : WV_RP2040_LCD_PANEL_HEIGHT) // Height of the attached LCD
+
+/*! \def WV RP2040 LCD GRAM Width [240]
+*  \brief Value
+*  \details Columns of the controller frame memory.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_GRAM_WIDTH
+#define WV_RP2040_LCD_GRAM_WIDTH 240 // Frame memory columns of the ST7789
+#endif
+
+/*! \def WV RP2040 LCD GRAM Height [320]
+*  \brief Value
+*  \details Rows of the controller frame memory, the rows past the panel height are off screen.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_GRAM_HEIGHT
+#define WV_RP2040_LCD_GRAM_HEIGHT 320 // Frame memory rows of the ST7789
+#endif
+
+/*! \def WV RP2040 LCD Stream Chunk [64]
+*  \brief Value
+*  \details Number of pixels staged at once while streaming a solid fill.
+*  \ingroup WV_RP2040_LCD
+*/
+#define WV_RP2040_LCD_STREAM_CHUNK 64 // Pixels staged per SPI write while filling
+
+/*! \def WV RP2040 LCD RAMRD Dummy Bits [8]
+*  \brief Value
+*  \details Clock cycles the controller lets pass between the memory read command and the first pixel.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_RAMRD_DUMMY_BITS
+#define WV_RP2040_LCD_RAMRD_DUMMY_BITS 8 // Dummy clocks before the memory read data
+#endif
+
+/*! \def WV RP2040 LCD Async Depth [4]
+*  \brief Value
+*  \details Submitted batches which may be in flight before submit() waits for the oldest one, a power of 2.
+*  \ingroup WV_RP2040_LCD
+*/
+#ifndef WV_RP2040_LCD_ASYNC_DEPTH
+#define WV_RP2040_LCD_ASYNC_DEPTH 4 // Completion tokens in flight
+#endif
+
+/*! \brief WV RP2040 LCD Token
+*   \ingroup WV_RP2040_LCD
+*
+*   Completion token of a batch of draw calls, returned by submit(). Tokens complete in
+*   the order they were issued and wrap around.
+*/
+typedef uint32_t WV_RP2040_LCD_TOKEN;
+
+/*! \brief WV RP2040 LCD Done Callback
+*   \ingroup WV_RP2040_LCD
+*
+*   Called once a submitted batch has been sent, usually from the DMA interrupt.
+*/
+typedef void (*WV_RP2040_LCD_DONE_CB)(WV_RP2040_LCD_TOKEN token, void *ctx);
+
+/*! \brief WV RP2040 LCD Blend Row
+*   \ingroup WV_RP2040_LCD
+*
+*   Composes one row of a blended draw call over what lies underneath, in RGB565.
+*/
+typedef void (*WV_RP2040_LCD_BLEND_ROW)(uint16_t *px, uint16_t row, uint16_t w, void *ctx);
+
+/*! \brief WV RP2040 LCD Point
+*   \ingroup WV_RP2040_LCD
+*
+*   Vertex of a polygon, in pixels, may lie off the panel.
+*/
+typedef struct _WV_RP2040_LCD_POINT_ {
+    int16_t x;
+    int16_t y;
+} WV_RP2040_LCD_POINT;
+
+class WV_RP2040_LCD_Tiles;
+
 /*! \class WV_RP2040_LCD
  *  \ingroup WV_RP2040_LCD
  *  \brief WV_RP2040_LCD class
@@ -77,11 +222,87 @@ namespace WV_RP2040
  */
 class WV_RP2040_LCD
 {
+public:
+    /*! \brief WV RP2040 LCD Present Mode
+    *   \ingroup WV_RP2040_LCD
+    *
+    *   How present() finds the parts of the framebuffer to send.
+    */
+    typedef enum _WV_RP2040_LCD_PRESENT_MODE_ {
+        PRESENT_DAMAGE          = 0, //send the merged bounding boxes touched by draw calls
+        PRESENT_TILES           = 1, //send the tiles whose checksum changed, catches direct writes too
+    } WV_RP2040_LCD_PRESENT_MODE;
+
+    /*! \brief WV RP2040 LCD Transport
+    *   \ingroup WV_RP2040_LCD
+    *
+    *   Bus backend used to talk with the LCD.
+    */
+    typedef enum _WV_RP2040_LCD_TRANSPORT_ {
+        TRANSPORT_SPI           = 0, //spi0 peripheral, DC toggled by the CPU
+        TRANSPORT_PIO           = 1, //PIO state machine driving CLK, DIN and DC itself
+    } WV_RP2040_LCD_TRANSPORT;
+
+    /*! \brief WV RP2040 LCD Orientation
+    *   \ingroup WV_RP2040_LCD
+    *
+    *   Clockwise rotation of the picture on the panel.
+    */
+    typedef enum _WV_RP2040_LCD_ORIENTATION_ {
+        ORIENT_0                = 0, //natural orientation of the panel
+        ORIENT_90               = 1, //a quarter turn, columns and rows exchanged
+        ORIENT_180              = 2, //upside down
+        ORIENT_270              = 3, //three quarter turns, columns and rows exchanged
+    } WV_RP2040_LCD_ORIENTATION;
+
+    /*! \brief WV RP2040 LCD Core1 Owner
+    *   \ingroup WV_RP2040_LCD
+    *
+    *   Module running on core1, only one of them can.
+    */
+    typedef enum _WV_RP2040_LCD_CORE1_OWNER_ {
+        CORE1_FREE              = 0, //nothing launched on core1
+        CORE1_DISPLAY_LIST      = 1, //the renderer of WV_RP2040_LCD_DisplayList
+        CORE1_LVGL              = 2, //the first LVGL draw thread of WV_RP2040_LCD_OS
+    } WV_RP2040_LCD_CORE1_OWNER;
+
 private:
     bool isInit;   /*!< Flag to check if the LCD is initialized */
     bool isInDatM; /*!< Flag to check if the LCD is in data mode */
     bool isListening; /*!< Flag to check if the LCD is listening */
     bool isBLLit; /*!< Flag to check if the backlight is lit */
+    WV_RP2040_LCD_DMA &dma; /*!< Transfer engine owning the LCD bus */
+    WV_RP2040_LCD_COLOR_MODE colorMode; /*!< Pixel format of the bus, colors are converted once per call */
+    WV_RP2040_LCD_ORIENTATION orientation; /*!< Rotation programmed into MADCTL */
+    bool isMirrored; /*!< True if the logical x axis is mirrored */
+    uint16_t originX; /*!< Frame memory column address of logical x = 0 */
+    uint16_t originY; /*!< Frame memory row address of logical y = 0 */
+
+    uint16_t *frameBuf; /*!< Off-screen framebuffer, NULL when drawing straight to the LCD */
+    uint16_t scratch[WV_RP2040_LCD_DMA_BUF_PX]; /*!< Line buffer of the framebuffer paths, the LCD paths stage in the DMA line buffers */
+    WV_RP2040_LCD_RECT fbWin; /*!< Window the framebuffer writes go to */
+    uint16_t fbCurX; /*!< Write cursor within fbWin */
+    uint16_t fbCurY; /*!< Write cursor within fbWin */
+    bool isPresenting; /*!< True while a present() may still read the framebuffer */
+    WV_RP2040_LCD_Damage damage; /*!< Areas of the framebuffer changed since the last present() */
+    WV_RP2040_LCD_PRESENT_MODE presentMode; /*!< How present() finds the changed areas */
+    WV_RP2040_LCD_Tiles *tiles; /*!< Tile checksums, allocated on the first use of PRESENT_TILES */
+    WV_RP2040_LCD_TOKEN presentToken; /*!< Completion token of the last present() */
+
+    /*! \brief WV RP2040 LCD Pending
+    *   \ingroup WV_RP2040_LCD
+    *
+    *   A submitted batch waiting for its completion.
+    */
+    typedef struct _WV_RP2040_LCD_PENDING_ {
+        WV_RP2040_LCD_TOKEN token;  /*!< Token of the batch */
+        WV_RP2040_LCD_DONE_CB cb;   /*!< Callback, NULL to only poll */
+        void *ctx;                  /*!< Callback context */
+    } WV_RP2040_LCD_PENDING;
+
+    WV_RP2040_LCD_PENDING pending[WV_RP2040_LCD_ASYNC_DEPTH]; /*!< In flight batches, indexed by token */
+    WV_RP2040_LCD_TOKEN lastToken; /*!< Token issued last */
+    volatile WV_RP2040_LCD_TOKEN doneToken; /*!< Token completed last, written by the DMA interrupt */
 
     /*! \brief Initialize LCD pins
     *  \ingroup WV_RP2040_LCD
@@ -99,6 +320,115 @@ private:
     */
     WV_RP2040_LCD();
 
+    /*! \brief Framebuffer Write
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Writes pixels into the framebuffer window the way the controller would into its
+    *  memory, left to right, top to bottom, wrapping at the window edges.
+    * 
+    *  \param pixels The pixels to be written, NULL to write color count times.
+    *  \param color The color used when pixels is NULL.
+    *  \param count The number of pixels.
+    */
+    void fb_Write(const uint16_t *pixels, uint16_t color, uint32_t count);
+
+    /*! \brief Wait Present
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Waits for a running present() before the framebuffer is touched again.
+    */
+    void wait_Present();
+
+    /*! \brief Token Done
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Notify callback of a submitted batch, runs its callback and retires the token.
+    */
+    static void token_Done(void *ctx);
+
+    /*! \brief Queue Framebuffer Region
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Queues one address window and the framebuffer rows of the region.
+    * 
+    *  \param r The region, within the LCD.
+    */
+    void queue_FbRegion(const WV_RP2040_LCD_RECT &r);
+
+    /*! \brief Draw Text
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Expands a text line row by row from the glyph atlas into a span buffer and
+    *  streams it into a single window, the gaps between glyphs are painted with bg.
+    * 
+    *  \param x The x-coordinate of the text.
+    *  \param y The y-coordinate of the text.
+    *  \param str The characters to be drawn.
+    *  \param len The number of characters.
+    *  \param color The color of the text.
+    *  \param bg The background color.
+    *  \param scale The integer scale of the glyphs.
+    */
+    void draw_Text(uint16_t x, uint16_t y, const char *str, size_t len, uint16_t color, uint16_t bg, uint8_t scale);
+
+    /*! \brief Emit Run
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Clips a run to the panel and sends it as one windowed fill. Every shape of the
+    *  rasterizer ends up here, one run per row, or per column for steep lines.
+    * 
+    *  \param x The x-coordinate of the run, may be off the panel.
+    *  \param y The y-coordinate of the run, may be off the panel.
+    *  \param w The width of the run.
+    *  \param h The height of the run.
+    *  \param color The color of the run.
+    */
+    void emit_Run(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+
+    /*! \brief Blend Rows
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Streams an on-panel rectangle through the line buffers, as many whole rows per
+    *  buffer as fit. Every buffer is loaded with what lies underneath, handed to blend()
+    *  row by row and sent in the pixel format of the bus.
+    * 
+    *  \param x The x-coordinate of the rectangle.
+    *  \param y The y-coordinate of the rectangle.
+    *  \param w The width of the rectangle, at most WV_RP2040_LCD_WIDTH.
+    *  \param h The height of the rectangle.
+    *  \param bg The RGB565 color assumed underneath when nothing is read back.
+    *  \param readBack True to read the panel underneath, the framebuffer is always read.
+    *  \param blend Composes the rows.
+    *  \param ctx The context passed to blend().
+    */
+    void blend_Rows(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t bg, bool readBack,
+        WV_RP2040_LCD_BLEND_ROW blend, void *ctx);
+
+    /*! \brief Line Runs
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Bresenham's line algorithm, the pixels sharing a row (or a column for steep lines)
+    *  are merged into a single run.
+    */
+    void line_Runs(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color);
+
+    /*! \brief Round Rect Runs
+    *  \ingroup WV_RP2040_LCD
+    *  \category Local Function
+    * 
+    *  Emits the rows of a rounded rectangle, filled or as a one pixel outline. A circle
+    *  is a rounded rectangle of width and height 2r + 1.
+    */
+    void round_Runs(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint16_t color, bool isFilled);
+
 public:
     /*! \brief Get Instance
     *  \ingroup WV_RP2040_LCD
@@ -157,7 +487,8 @@ public:
     /*! \brief Set Backlight
     *  \ingroup WV_RP2040_LCD
     * 
-    *  Sets the backlight of the LCD.
+    *  Sets the backlight of the LCD to full brightness or off, see WV_RP2040_LCD_Backlight
+    *  for dimming and fades.
     * 
     *  \param setLit Set to true to turn on the backlight, false to turn it off.
     */
@@ -175,14 +506,89 @@ public:
     /*! \brief Initialize LCD
     *  \ingroup WV_RP2040_LCD
     * 
-    *  Sends the initialization sequence to the LCD.
+    *  Selects the bus backend and sends the initialization sequence to the LCD.
+    *  Colors passed to the drawing calls stay RGB565 in both color modes, they are
+    *  converted once per call, pixel buffers are converted while they are staged.
+    *  The panel starts out in the orientation of WV_RP2040_LCD_ROTATION.
+    * 
+    *  \param transport The bus backend to be used, see WV_RP2040_LCD_TRANSPORT.
+    *  \param mode The pixel format of the bus, COLOR_RGB444 sends 3 bytes per 2 pixels.
+    */
+    void initialize_LCD(WV_RP2040_LCD_TRANSPORT transport = TRANSPORT_SPI, WV_RP2040_LCD_COLOR_MODE mode = COLOR_RGB565);
+
+    /*! \brief Get Color Mode
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \return The pixel format selected by initialize_LCD().
+    */
+    WV_RP2040_LCD_COLOR_MODE get_ColorMode() const;
+
+    /*! \brief Claim Core1
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Claims core1 for a module before it is launched there. Core1 is never given back,
+    *  the display list and the LVGL draw threads exclude each other.
+    * 
+    *  \param owner The module about to launch core1.
+    *  \return True if core1 was free or already claimed by owner.
+    */
+    static bool claim_Core1(WV_RP2040_LCD_CORE1_OWNER owner);
+
+    /*! \brief Get Core1 Owner
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \return The module running on core1, CORE1_FREE if none.
+    */
+    static WV_RP2040_LCD_CORE1_OWNER get_Core1Owner();
+
+    /*! \brief Get Native Color
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Converts a color for code queueing pixels on WV_RP2040_LCD_DMA itself.
+    * 
+    *  \param color The RGB565 color.
+    *  \return The color in the pixel format of the bus.
+    */
+    uint16_t get_NativeColor(uint16_t color) const;
+
+    /*! \brief Set Orientation
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Rotates and mirrors the picture through the memory access control register
+    *  (MADCTL), the controller walks its frame memory in the new order, so the draw calls
+    *  keep their logical coordinates and pay nothing per pixel. The address offsets of
+    *  the orientation are applied to every window.
+    * 
+    *  The logical size WV_RP2040_LCD_WIDTH x WV_RP2040_LCD_HEIGHT is fixed at build time
+    *  by WV_RP2040_LCD_ROTATION, a quarter turn of a non square panel is refused. What is
+    *  on the panel is not redrawn, a framebuffer is sent whole by the next present().
+    *  The console and the terminal scroll along the frame memory rows and put the panel
+    *  back to ORIENT_0.
+    * 
+    *  \param rotation The clockwise rotation.
+    *  \param setMirrored True to mirror the picture left to right, after the rotation.
+    *  \return False if the orientation does not fit the logical size.
+    */
+    bool set_Orientation(WV_RP2040_LCD_ORIENTATION rotation, bool setMirrored = false);
+
+    /*! \brief Get Orientation
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \return The rotation selected by set_Orientation().
     */
-    void initialize_LCD();
+    WV_RP2040_LCD_ORIENTATION get_Orientation() const;
+
+    /*! \brief Is Mirrored
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \return True if the picture is mirrored left to right.
+    */
+    bool is_Mirrored() const;
 
     /*! \brief Send Command
     *  \ingroup WV_RP2040_LCD
     * 
-    *  Sends a command to the LCD.
+    *  Sends a command to the LCD, after everything queued before it.
     * 
     *  \param cmd The command byte to be sent.
     */
@@ -191,12 +597,49 @@ public:
     /*! \brief Send Data
     *  \ingroup WV_RP2040_LCD
     * 
-    *  Sends data to the LCD.
+    *  Sends data to the LCD, after everything queued before it.
     * 
     *  \param data The data byte to be sent.
     */
     void send_Data(uint8_t data);
 
+    /*! \brief Set Window
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Queues the column and row address window once and the memory write
+    *  command, so that the following pixels stream into the window left to right,
+    *  top to bottom without any further addressing.
+    * 
+    *  \param x0 The starting x-coordinate of the window.
+    *  \param y0 The starting y-coordinate of the window.
+    *  \param x1 The ending x-coordinate of the window (inclusive).
+    *  \param y1 The ending y-coordinate of the window (inclusive).
+    */
+    void set_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+    /*! \brief Write Pixels
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Streams the given RGB565 pixels into the current window. The pixels are
+    *  copied into the ping-pong line buffers, so the caller buffer can be reused
+    *  right away. Call set_Window() first.
+    * 
+    *  \param pixels The RGB565 pixels to be sent.
+    *  \param count The number of pixels to be sent.
+    */
+    void write_Pixels(const uint16_t *pixels, uint32_t count);
+
+    /*! \brief Fill Pixels
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Queues count pixels of the same color into the current window, sent by DMA
+    *  from a single source word. Call set_Window() first.
+    * 
+    *  \param color The color of the pixels.
+    *  \param count The number of pixels to be sent.
+    */
+    void fill_Pixels(uint16_t color, uint32_t count);
+
     /*! \brief Draw Pixel
     *  \ingroup WV_RP2040_LCD
     * 
@@ -211,7 +654,7 @@ public:
     /*! \brief Draw Line
     *  \ingroup WV_RP2040_LCD
     * 
-    *  Draws a line on the LCD.
+    *  Draws a line on the LCD, clipped to the panel.
     * 
     *  \param x0 The starting x-coordinate of the line.
     *  \param y0 The starting y-coordinate of the line.
@@ -219,12 +662,36 @@ public:
     *  \param y1 The ending y-coordinate of the line.
     *  \param color The color of the line.
     */
-    void draw_Line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+    void draw_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+    /*! \brief Draw Horizontal Line
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws a horizontal line on the LCD as a single window fill.
+    * 
+    *  \param x The starting x-coordinate of the line.
+    *  \param y The y-coordinate of the line.
+    *  \param w The width of the line.
+    *  \param color The color of the line.
+    */
+    void draw_HLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color);
+
+    /*! \brief Draw Vertical Line
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws a vertical line on the LCD as a single window fill.
+    * 
+    *  \param x The x-coordinate of the line.
+    *  \param y The starting y-coordinate of the line.
+    *  \param h The height of the line.
+    *  \param color The color of the line.
+    */
+    void draw_VLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color);
 
     /*! \brief Draw Rectangle
     *  \ingroup WV_RP2040_LCD
     * 
-    *  Draws a rectangle on the LCD.
+    *  Draws a filled rectangle on the LCD, clipped to the panel.
     * 
     *  \param x The x-coordinate of the top-left corner.
     *  \param y The y-coordinate of the top-left corner.
@@ -232,7 +699,112 @@ public:
     *  \param h The height of the rectangle.
     *  \param color The color of the rectangle.
     */
-    void draw_Rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void draw_Rectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+    /*! \brief Draw Rounded Rectangle
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws the outline of a rounded rectangle on the LCD.
+    * 
+    *  \param x The x-coordinate of the top-left corner.
+    *  \param y The y-coordinate of the top-left corner.
+    *  \param w The width of the rectangle.
+    *  \param h The height of the rectangle.
+    *  \param r The corner radius, clamped to half the shorter side.
+    *  \param color The color of the outline.
+    */
+    void draw_RoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
+
+    /*! \brief Fill Rounded Rectangle
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws a filled rounded rectangle on the LCD.
+    * 
+    *  \param x The x-coordinate of the top-left corner.
+    *  \param y The y-coordinate of the top-left corner.
+    *  \param w The width of the rectangle.
+    *  \param h The height of the rectangle.
+    *  \param r The corner radius, clamped to half the shorter side.
+    *  \param color The color of the rectangle.
+    */
+    void fill_RoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
+
+    /*! \brief Draw Circle
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws the outline of a circle on the LCD.
+    * 
+    *  \param cx The x-coordinate of the center.
+    *  \param cy The y-coordinate of the center.
+    *  \param r The radius of the circle.
+    *  \param color The color of the outline.
+    */
+    void draw_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color);
+
+    /*! \brief Fill Circle
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws a filled circle on the LCD.
+    * 
+    *  \param cx The x-coordinate of the center.
+    *  \param cy The y-coordinate of the center.
+    *  \param r The radius of the circle.
+    *  \param color The color of the circle.
+    */
+    void fill_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color);
+
+    /*! \brief Draw Triangle
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws the outline of a triangle on the LCD.
+    * 
+    *  \param x0 The x-coordinate of the first vertex.
+    *  \param y0 The y-coordinate of the first vertex.
+    *  \param x1 The x-coordinate of the second vertex.
+    *  \param y1 The y-coordinate of the second vertex.
+    *  \param x2 The x-coordinate of the third vertex.
+    *  \param y2 The y-coordinate of the third vertex.
+    *  \param color The color of the outline.
+    */
+    void draw_Triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+    /*! \brief Fill Triangle
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws a filled triangle on the LCD.
+    * 
+    *  \param x0 The x-coordinate of the first vertex.
+    *  \param y0 The y-coordinate of the first vertex.
+    *  \param x1 The x-coordinate of the second vertex.
+    *  \param y1 The y-coordinate of the second vertex.
+    *  \param x2 The x-coordinate of the third vertex.
+    *  \param y2 The y-coordinate of the third vertex.
+    *  \param color The color of the triangle.
+    */
+    void fill_Triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+    /*! \brief Draw Polygon
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws the closed outline through the given vertices on the LCD.
+    * 
+    *  \param pts The vertices of the polygon.
+    *  \param count The number of vertices.
+    *  \param color The color of the outline.
+    */
+    void draw_Polygon(const WV_RP2040_LCD_POINT *pts, size_t count, uint16_t color);
+
+    /*! \brief Fill Polygon
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws a filled convex polygon on the LCD, one run per row. Concave polygons
+    *  get each row filled between their outermost edges.
+    * 
+    *  \param pts The vertices of the polygon, in either winding order.
+    *  \param count The number of vertices.
+    *  \param color The color of the polygon.
+    */
+    void fill_Polygon(const WV_RP2040_LCD_POINT *pts, size_t count, uint16_t color);
 
     /*! \brief Draw Character
     *  \ingroup WV_RP2040_LCD
@@ -244,21 +816,77 @@ public:
     *  \param c The character to be drawn.
     *  \param color The color of the character.
     *  \param bg The background color.
+    *  \param scale The integer scale, 1 - WV_RP2040_LCD_FONT_MAX_SCALE.
     */
-    void draw_Char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg);
+    void draw_Char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg, uint8_t scale = 1);
 
     /*! \brief Draw String
     *  \ingroup WV_RP2040_LCD
     * 
-    *  Draws a string on the LCD.
+    *  Draws a string on the LCD. The whole line goes out as one window write,
+    *  so a status line costs a single address setup instead of one per character.
     * 
     *  \param x The x-coordinate of the string.
     *  \param y The y-coordinate of the string.
     *  \param str The string to be drawn.
     *  \param color The color of the string.
     *  \param bg The background color.
+    *  \param scale The integer scale, 1 - WV_RP2040_LCD_FONT_MAX_SCALE.
     */
-    void draw_String(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg);
+    void draw_String(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t scale = 1);
+
+    /*! \brief Draw Image
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws a compressed image, clipped to the panel. The packets are decoded straight
+    *  into the line buffers while the previous ones are sent, the image is never
+    *  unpacked in RAM. An opaque image goes out as one window, a keyed one as one window
+    *  per opaque span of a row, the pixels of the key color are left as they are.
+    * 
+    *  A translucent image is blended over what lies underneath, which is read back
+    *  from the panel without a framebuffer, see fill_RectAlpha().
+    * 
+    *  \param x The x-coordinate of the top left corner, may lie off the panel.
+    *  \param y The y-coordinate of the top left corner, may lie off the panel.
+    *  \param img The image, usually a header written by NavourAssets.
+    *  \param alpha The opacity of the image, 0 - 255.
+    */
+    void draw_Image(int16_t x, int16_t y, const WV_RP2040_LCD_IMAGE &img, uint8_t alpha = 255);
+
+    /*! \brief Fill Rect Alpha
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Fills a rectangle with a translucent color, clipped to the panel. With a
+    *  framebuffer attached it is blended there. Without one the pixels underneath are
+    *  read back from the panel, which is slow (see read_Region()), so keep such
+    *  rectangles small or draw into a framebuffer.
+    * 
+    *  \param x The x-coordinate of the rectangle, may lie off the panel.
+    *  \param y The y-coordinate of the rectangle, may lie off the panel.
+    *  \param w The width of the rectangle.
+    *  \param h The height of the rectangle.
+    *  \param color The color of the rectangle.
+    *  \param alpha The opacity of the color, 0 - 255.
+    */
+    void fill_RectAlpha(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, uint8_t alpha);
+
+    /*! \brief Draw Mask
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Draws a color through an 8 bit coverage mask, such as an anti-aliased glyph,
+    *  clipped to the panel. Without a framebuffer the mask is blended over bg, like
+    *  draw_String() does, and never reads the panel. With a framebuffer attached it is
+    *  blended over the framebuffer and bg is not used.
+    * 
+    *  \param x The x-coordinate of the mask, may lie off the panel.
+    *  \param y The y-coordinate of the mask, may lie off the panel.
+    *  \param w The width of the mask.
+    *  \param h The height of the mask.
+    *  \param mask w * h opacities, 0 - 255, row by row.
+    *  \param color The color drawn.
+    *  \param bg The background color.
+    */
+    void draw_Mask(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *mask, uint16_t color, uint16_t bg);
 
     /*! \brief Clear Screen
     *  \ingroup WV_RP2040_LCD
@@ -272,12 +900,143 @@ public:
     /*! \brief Read Data
     *  \ingroup WV_RP2040_LCD
     * 
-    *  Reads a byte of data from the LCD.
+    *  Reads a byte of data from the LCD. Only available with TRANSPORT_SPI.
     * 
-    *  \return The data byte read from the LCD.
+    *  \return The data byte read from the LCD, 0 with other transports.
     */
     uint8_t read_Data();
 
+    /*! \brief Read Region
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Reads a rectangle of the frame memory in a single memory read transaction, the
+    *  controller answers with RGB666 which is narrowed to RGB565. Everything queued before
+    *  is sent first. With a framebuffer attached the pixels come from the framebuffer.
+    * 
+    *  The read is clocked by the CPU at the read speed of the controller, about 20 times
+    *  slower than writing, it is meant for captures and tests, not for drawing.
+    * 
+    *  \param x0 The starting x-coordinate of the region.
+    *  \param y0 The starting y-coordinate of the region, may lie below the panel.
+    *  \param x1 The ending x-coordinate of the region (inclusive).
+    *  \param y1 The ending y-coordinate of the region (inclusive).
+    *  \param dst (x1 - x0 + 1) * (y1 - y0 + 1) RGB565 pixels, row by row.
+    *  \return False if the region does not lie inside the frame memory.
+    */
+    bool read_Region(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t *dst);
+
+    /*! \brief Wait Idle
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Fence, drawing calls only queue their work and return right away. This waits
+    *  until everything queued so far has been sent to the LCD.
+    */
+    void wait_Idle();
+
+    /*! \brief Submit
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Closes the batch of draw calls queued since the last submit() and returns its
+    *  completion token right away. A batch is done once its pixels have been handed to
+    *  the bus, so the buffers it was drawn from may be reused.
+    * 
+    *  At most WV_RP2040_LCD_ASYNC_DEPTH batches are in flight, a further submit() waits
+    *  for the oldest one. Check can_Submit() first to skip a redraw instead of waiting.
+    * 
+    *  \param cb Called with the token once the batch is done, NULL to poll with is_Done().
+    *  \param ctx The context passed to the callback.
+    *  \return The completion token of the batch.
+    */
+    WV_RP2040_LCD_TOKEN submit(WV_RP2040_LCD_DONE_CB cb = NULL, void *ctx = NULL);
+
+    /*! \brief Is Done
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \param token The token returned by submit().
+    *  \return True once the batch has been sent.
+    */
+    bool is_Done(WV_RP2040_LCD_TOKEN token) const;
+
+    /*! \brief Wait Done
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Waits for a batch only, unlike wait_Idle() the work queued after it may still run.
+    * 
+    *  \param token The token returned by submit().
+    */
+    void wait_Done(WV_RP2040_LCD_TOKEN token);
+
+    /*! \brief Get In Flight
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \return The number of submitted batches not done yet.
+    */
+    uint8_t get_InFlight() const;
+
+    /*! \brief Can Submit
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \return True if submit() would return without waiting.
+    */
+    bool can_Submit() const;
+
+    /*! \brief Set Framebuffer
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Attaches an off-screen framebuffer. While attached, every draw call renders into it
+    *  and records the bounding box it touched, nothing is sent until present().
+    * 
+    *  The framebuffer holds the pixels in the format of the bus, RGB444 in the low 12 bits
+    *  with COLOR_RGB444, so present() sends it as it is.
+    * 
+    *  \param fb WV_RP2040_LCD_WIDTH * WV_RP2040_LCD_HEIGHT pixels, NULL to draw straight to the LCD again.
+    */
+    void set_Framebuffer(uint16_t *fb);
+
+    /*! \brief Get Framebuffer
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \return The attached framebuffer, NULL if none.
+    */
+    uint16_t * get_Framebuffer() const;
+
+    /*! \brief Set Damage Cap
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Sets the number of damaged regions kept before they are forced to merge, each
+    *  region costs one address window on present().
+    * 
+    *  \param cap The cap, 1 - WV_RP2040_LCD_DAMAGE_MAX_RECTS.
+    */
+    void set_DamageCap(uint8_t cap);
+
+    /*! \brief Get Damage
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  \return The regions changed since the last present().
+    */
+    const WV_RP2040_LCD_Damage & get_Damage() const;
+
+    /*! \brief Set Present Mode
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Selects how present() finds the parts of the framebuffer to send. PRESENT_TILES
+    *  checksums every WV_RP2040_LCD_TILE_SIZE tile and sends the changed ones, runs of
+    *  changed tiles in a tile row go out as one window. The first present after switching
+    *  sends the whole framebuffer.
+    * 
+    *  \param mode The present mode.
+    */
+    void set_PresentMode(WV_RP2040_LCD_PRESENT_MODE mode);
+
+    /*! \brief Present
+    *  \ingroup WV_RP2040_LCD
+    * 
+    *  Queues the changed regions of the framebuffer to the LCD, see set_PresentMode().
+    *  Returns right away, the next draw call waits for the transfer to finish.
+    */
+    void present();
+
 };
 
 }
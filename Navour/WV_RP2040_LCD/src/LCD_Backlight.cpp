@@ -0,0 +1,114 @@
+#include "pico/stdlib.h"
+#include "WV_RP2040_LCD.h"
+#include "LCD_Backlight.h"
+#if !PICO_NO_HARDWARE
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/clocks.h"
+#endif
+
+WV_RP2040::WV_RP2040_LCD_Backlight::WV_RP2040_LCD_Backlight() :
+    steps(), blSlice(0), blChannel(0), dmaChannel(-1), level(0), fadeTo(0), fadeSteps(0) {
+#if !PICO_NO_HARDWARE
+    blSlice = pwm_gpio_to_slice_num(WV_RP2040_LCD_BL_PIN);
+    blChannel = pwm_gpio_to_channel(WV_RP2040_LCD_BL_PIN);
+    static_assert(WV_RP2040_LCD_BL_PACE_SLICE != WV_RP2040_LCD_BL_PIN / 2 % 8, "The pacing slice must not be the backlight slice");
+
+    pwm_config cfg = pwm_get_default_config();
+    pwm_config_set_wrap(&cfg, WV_RP2040_LCD_BL_PWM_WRAP);
+    pwm_init(blSlice, &cfg, false);
+    pwm_set_chan_level(blSlice, blChannel, 0);
+    pwm_set_enabled(blSlice, true);
+    gpio_set_function(WV_RP2040_LCD_BL_PIN, GPIO_FUNC_PWM);
+
+    dmaChannel = dma_claim_unused_channel(true);
+#endif
+}
+
+WV_RP2040::WV_RP2040_LCD_Backlight & WV_RP2040::WV_RP2040_LCD_Backlight::get_Inst() {
+    static WV_RP2040_LCD_Backlight __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Backlight::stop_Fade() {
+    if (!fadeSteps) return;
+
+    // The level the fade got to becomes the start of whatever comes next
+    level = get_Level();
+#if !PICO_NO_HARDWARE
+    dma_channel_abort(dmaChannel);
+    pwm_set_enabled(WV_RP2040_LCD_BL_PACE_SLICE, false);
+#endif
+    fadeSteps = 0;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Backlight::set_Level(uint8_t setLevel) {
+    stop_Fade();
+    level = setLevel;
+#if !PICO_NO_HARDWARE
+    pwm_set_chan_level(blSlice, blChannel, WV_RP2040_LCD_BL_GAMMA_LUT.duty[setLevel]);
+#endif
+}
+
+uint8_t WV_RP2040::WV_RP2040_LCD_Backlight::get_Level() const {
+    if (!fadeSteps) return level;
+
+    uint32_t done = fadeSteps;
+#if !PICO_NO_HARDWARE
+    done -= dma_channel_hw_addr(dmaChannel)->transfer_count;
+#endif
+    return (uint8_t)(level + ((int32_t)fadeTo - level) * (int32_t)done / fadeSteps);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Backlight::fade_To(uint8_t target, uint32_t ms) {
+    stop_Fade();
+    if (!ms || target == level) {
+        set_Level(target);
+        return;
+    }
+#if PICO_NO_HARDWARE
+    // No pacing slice on the host, the fade ends right away
+    set_Level(target);
+#else
+    // No more steps than levels to go through, the other channel of the slice keeps its compare value
+    uint32_t diff = (target > level) ? target - level : level - target;
+    uint8_t n = (diff < WV_RP2040_LCD_BL_FADE_STEPS) ? (uint8_t)diff : WV_RP2040_LCD_BL_FADE_STEPS;
+    uint8_t shift = (blChannel == PWM_CHAN_B) ? 16 : 0;
+    uint32_t keep = pwm_hw->slice[blSlice].cc & ~(0xFFFFu << shift);
+    for (uint8_t i = 0; i < n; i++) {
+        int32_t l = level + ((int32_t)target - level) * (i + 1) / n;
+        steps[i] = keep | ((uint32_t)WV_RP2040_LCD_BL_GAMMA_LUT.duty[l] << shift);
+    }
+
+    // One pacing period per step, the integer divider stretches it to 65536 * 255 cycles
+    uint64_t cycles = (uint64_t)clock_get_hz(clk_sys) / 1000 * ms / n;
+    uint64_t div = cycles / 65536 + 1;
+    if (div > 255) div = 255;
+    uint64_t period = cycles / div;
+    if (period > 65536) period = 65536;
+    if (period < 2) period = 2;
+    pwm_set_enabled(WV_RP2040_LCD_BL_PACE_SLICE, false);
+    pwm_set_clkdiv_int_frac(WV_RP2040_LCD_BL_PACE_SLICE, (uint8_t)div, 0);
+    pwm_set_wrap(WV_RP2040_LCD_BL_PACE_SLICE, (uint16_t)(period - 1));
+    pwm_hw->slice[WV_RP2040_LCD_BL_PACE_SLICE].ctr = 0;
+
+    dma_channel_config c = dma_channel_get_default_config(dmaChannel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, DREQ_PWM_WRAP0 + WV_RP2040_LCD_BL_PACE_SLICE);
+    dma_channel_configure(dmaChannel, &c, &pwm_hw->slice[blSlice].cc, steps, n, true);
+
+    fadeTo = target;
+    fadeSteps = n;
+    pwm_set_enabled(WV_RP2040_LCD_BL_PACE_SLICE, true);
+#endif
+}
+
+bool WV_RP2040::WV_RP2040_LCD_Backlight::is_Fading() const {
+#if PICO_NO_HARDWARE
+    return false;
+#else
+    return fadeSteps && dma_channel_is_busy(dmaChannel);
+#endif
+}
@@ -0,0 +1,117 @@
+#include "pico/stdlib.h"
+#include "LCD_Blend.h"
+
+/*! \def WV RP2040 LCD Blend 5 Bit Lanes [0x001F001F]
+*  \brief Value
+*  \details Red or blue of two pixels, one per 16 bit lane.
+*  \ingroup WV_RP2040_LCD_Blend
+*/
+#define WV_RP2040_LCD_BLEND_LANE5 0x001F001Fu // Two 5 bit channels
+
+/*! \def WV RP2040 LCD Blend 6 Bit Lanes [0x003F003F]
+*  \brief Value
+*  \details Green of two pixels, one per 16 bit lane.
+*  \ingroup WV_RP2040_LCD_Blend
+*/
+#define WV_RP2040_LCD_BLEND_LANE6 0x003F003Fu // Two 6 bit channels
+
+/*! \brief Load Pair
+*  \ingroup WV_RP2040_LCD_Blend
+*  \category Local Function
+*
+*  Two pixels as one word, read halfword wise as the buffers are only 2 byte aligned.
+*/
+static inline uint32_t load_Pair(const uint16_t *p) {
+    return p[0] | ((uint32_t)p[1] << 16);
+}
+
+/*! \brief Store Pair
+*  \ingroup WV_RP2040_LCD_Blend
+*  \category Local Function
+*
+*  Packs the blended lanes back into two RGB565 pixels.
+*/
+static inline void store_Pair(uint16_t *p, uint32_t r, uint32_t g, uint32_t b) {
+    uint32_t v = (r << 11) | (g << 5) | b;
+    p[0] = (uint16_t)v;
+    p[1] = (uint16_t)(v >> 16);
+}
+
+/*! \brief Widen Alpha
+*  \ingroup WV_RP2040_LCD_Blend
+*  \category Local Function
+*
+*  0 - 255 to 0 - 256, so 255 gives the drawn color exactly.
+*/
+static inline uint32_t widen_Alpha(uint8_t alpha) {
+    return alpha + (alpha >> 7);
+}
+
+void __not_in_flash_func(WV_RP2040::blend_Fill)(uint16_t *dst, uint16_t color, uint8_t alpha, size_t count) {
+    uint32_t a = widen_Alpha(alpha), inv = 256 - a;
+    if (a == 0) return;
+
+    // The color side is the same for every pair, scaled once
+    uint32_t cc = color | ((uint32_t)color << 16);
+    uint32_t fr = ((cc >> 11) & WV_RP2040_LCD_BLEND_LANE5) * a;
+    uint32_t fg = ((cc >> 5) & WV_RP2040_LCD_BLEND_LANE6) * a;
+    uint32_t fb = (cc & WV_RP2040_LCD_BLEND_LANE5) * a;
+
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        uint32_t p = load_Pair(&dst[i]);
+        store_Pair(&dst[i],
+            ((fr + ((p >> 11) & WV_RP2040_LCD_BLEND_LANE5) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE5,
+            ((fg + ((p >> 5) & WV_RP2040_LCD_BLEND_LANE6) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE6,
+            ((fb + (p & WV_RP2040_LCD_BLEND_LANE5) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE5);
+    }
+    if (i < count) dst[i] = blend_RGB565(color, dst[i], alpha);
+}
+
+void __not_in_flash_func(WV_RP2040::blend_Mask)(uint16_t *dst, uint16_t color, const uint8_t *mask, size_t count) {
+    uint32_t cc = color | ((uint32_t)color << 16);
+    uint32_t cr = (cc >> 11) & WV_RP2040_LCD_BLEND_LANE5;
+    uint32_t cg = (cc >> 5) & WV_RP2040_LCD_BLEND_LANE6;
+    uint32_t cb = cc & WV_RP2040_LCD_BLEND_LANE5;
+
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        uint8_t m0 = mask[i], m1 = mask[i + 1];
+        if (m0 != m1) {
+            // Edge of a glyph, the two pixels need their own alpha
+            dst[i] = blend_RGB565(color, dst[i], m0);
+            dst[i + 1] = blend_RGB565(color, dst[i + 1], m1);
+            continue;
+        }
+        if (m0 == 0) continue;
+        if (m0 == 255) {
+            dst[i] = color;
+            dst[i + 1] = color;
+            continue;
+        }
+
+        uint32_t a = widen_Alpha(m0), inv = 256 - a;
+        uint32_t p = load_Pair(&dst[i]);
+        store_Pair(&dst[i],
+            ((cr * a + ((p >> 11) & WV_RP2040_LCD_BLEND_LANE5) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE5,
+            ((cg * a + ((p >> 5) & WV_RP2040_LCD_BLEND_LANE6) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE6,
+            ((cb * a + (p & WV_RP2040_LCD_BLEND_LANE5) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE5);
+    }
+    if (i < count) dst[i] = blend_RGB565(color, dst[i], mask[i]);
+}
+
+void __not_in_flash_func(WV_RP2040::blend_Over)(uint16_t *dst, const uint16_t *src, uint8_t alpha, size_t count) {
+    uint32_t a = widen_Alpha(alpha), inv = 256 - a;
+    if (a == 0) return;
+
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        uint32_t s = load_Pair(&src[i]);
+        uint32_t p = load_Pair(&dst[i]);
+        store_Pair(&dst[i],
+            ((((s >> 11) & WV_RP2040_LCD_BLEND_LANE5) * a + ((p >> 11) & WV_RP2040_LCD_BLEND_LANE5) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE5,
+            ((((s >> 5) & WV_RP2040_LCD_BLEND_LANE6) * a + ((p >> 5) & WV_RP2040_LCD_BLEND_LANE6) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE6,
+            (((s & WV_RP2040_LCD_BLEND_LANE5) * a + (p & WV_RP2040_LCD_BLEND_LANE5) * inv) >> 8) & WV_RP2040_LCD_BLEND_LANE5);
+    }
+    if (i < count) dst[i] = blend_RGB565(src[i], dst[i], alpha);
+}
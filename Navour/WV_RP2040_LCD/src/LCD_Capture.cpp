@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <string.h>
+#include "LCD_Capture.h"
+
+static_assert(WV_RP2040_LCD_CAPTURE_CHUNK >= 32, "A header line must fit into the text chunk");
+
+static void capture_Stdout(const char *text, size_t len, void *ctx) {
+    fwrite(text, 1, len, stdout);
+}
+
+WV_RP2040::WV_RP2040_LCD_Capture::WV_RP2040_LCD_Capture() :
+    textLen(0), sentBytes(0), sink(capture_Stdout), sinkCtx(NULL) {
+}
+
+WV_RP2040::WV_RP2040_LCD_Capture & WV_RP2040::WV_RP2040_LCD_Capture::get_Inst() {
+    static WV_RP2040_LCD_Capture __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Capture::set_Sink(WV_RP2040_LCD_CAPTURE_SINK setSink, void *ctx) {
+    sink = (setSink) ? setSink : capture_Stdout;
+    sinkCtx = ctx;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Capture::flush_Text() {
+    if (!textLen) return;
+    sink(text, textLen, sinkCtx);
+    sentBytes += textLen;
+    textLen = 0;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Capture::put_Text(const char *str, size_t len) {
+    while (len) {
+        size_t n = sizeof(text) - textLen;
+        if (n > len) n = len;
+        memcpy(&text[textLen], str, n);
+        textLen += n;
+        str += n;
+        len -= n;
+        if (textLen == sizeof(text)) flush_Text();
+    }
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_Capture::capture(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    static const char hex[] = "0123456789ABCDEF";
+    WV_RP2040_LCD &lcd = WV_RP2040_LCD::get_Inst();
+    if (!w || !h || w > WV_RP2040_LCD_WIDTH) return 0;
+
+    char line[32];
+    uint32_t runs = 0;
+    textLen = 0;
+    sentBytes = 0;
+
+    put_Text(line, snprintf(line, sizeof(line), "SHOT %u %u %u %u\n", (unsigned)x, (unsigned)y, (unsigned)w, (unsigned)h));
+    for (uint16_t r = 0; r < h; r++) {
+        // One row in flight, its runs go out before the next one is read
+        if (!lcd.read_Region(x, y + r, x + w - 1, y + r, row)) {
+            textLen = 0;
+            return 0;
+        }
+        put_Text(line, snprintf(line, sizeof(line), "%u:", (unsigned)(y + r)));
+
+        for (uint16_t i = 0; i < w; ) {
+            uint16_t c = row[i];
+            uint16_t n = 1;
+            while (i + n < w && n < 256 && row[i + n] == c) n++;
+
+            char run[6] = { hex[(n - 1) >> 4], hex[(n - 1) & 0xF],
+                hex[c >> 12], hex[(c >> 8) & 0xF], hex[(c >> 4) & 0xF], hex[c & 0xF] };
+            put_Text(run, sizeof(run));
+            runs++;
+            i += n;
+        }
+        put_Text("\n", 1);
+    }
+    put_Text(line, snprintf(line, sizeof(line), "END %u\n", (unsigned)runs));
+    flush_Text();
+    return sentBytes;
+}
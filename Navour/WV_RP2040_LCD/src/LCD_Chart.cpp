@@ -0,0 +1,85 @@
+#include "LCD_Chart.h"
+
+WV_RP2040::WV_RP2040_LCD_Chart::WV_RP2040_LCD_Chart(lv_obj_t *chart, lv_chart_series_t *series, const WV_RP2040_ADC_Ring &ring, WV_RP2040_LCD_CHART_CONV conv) :
+    chart(chart), series(series), ring(ring), conv(conv), tail(ring.get_Head()), cursor(0), timer(NULL) {
+    // Points stay in place, shift mode would move all of them with every sample
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_set_all_values(chart, series, LV_CHART_POINT_NONE);
+}
+
+WV_RP2040::WV_RP2040_LCD_Chart::~WV_RP2040_LCD_Chart() {
+    if (timer) lv_timer_delete(timer);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Chart::timer_CB(lv_timer_t *t) {
+    ((WV_RP2040_LCD_Chart *)lv_timer_get_user_data(t))->update();
+}
+
+void WV_RP2040::WV_RP2040_LCD_Chart::start(uint32_t periodMs) {
+    if (timer) lv_timer_set_period(timer, periodMs);
+    else timer = lv_timer_create(timer_CB, periodMs, this);
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_Chart::update() {
+    uint32_t pcnt = lv_chart_get_point_count(chart);
+    int32_t *y = lv_chart_get_series_y_array(chart, series);
+    if (!pcnt || !y) return 0;
+    if (cursor >= pcnt) cursor = 0;
+
+    // Straight from the ring into the points of the series
+    uint16_t raw[WV_RP2040_LCD_CHART_BATCH];
+    uint32_t first = cursor, total = 0, n;
+    while ((n = ring.read(tail, raw, WV_RP2040_LCD_CHART_BATCH))) {
+        for (uint32_t i = 0; i < n; i++) {
+            y[cursor] = conv ? conv(raw[i]) : raw[i];
+            cursor = (cursor + 1 == pcnt) ? 0 : cursor + 1;
+        }
+        total += n;
+    }
+    if (!total) return 0;
+
+    // The gap in front of the cursor parts new from old
+    y[cursor] = LV_CHART_POINT_NONE;
+    invalidate_Points(first, total + 1);
+    return total;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Chart::invalidate_Points(uint32_t first, uint32_t count) {
+    uint32_t pcnt = lv_chart_get_point_count(chart);
+    if (count >= pcnt) {
+        lv_obj_invalidate(chart);
+        return;
+    }
+
+    // The lines from the point before and to the point after change as well
+    uint32_t from = first ? first - 1 : 0, to = first + count;
+    if (to < pcnt) {
+        invalidate_Columns(from, to);
+        return;
+    }
+    invalidate_Columns(from, pcnt - 1);
+    invalidate_Columns(0, to - pcnt);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Chart::invalidate_Columns(uint32_t from, uint32_t to) {
+    uint32_t pcnt = lv_chart_get_point_count(chart);
+    if (pcnt < 2) {
+        lv_obj_invalidate(chart);
+        return;
+    }
+
+    // Point i sits at w * i / (pcnt - 1) of the content, lines and dots reach past it
+    lv_area_t a;
+    lv_obj_get_content_coords(chart, &a);
+    int32_t w = lv_area_get_width(&a);
+    int32_t x0 = a.x1 - lv_obj_get_scroll_left(chart);
+    int32_t lineW = lv_obj_get_style_line_width(chart, LV_PART_ITEMS);
+    int32_t dotW = lv_obj_get_style_width(chart, LV_PART_INDICATOR) / 2;
+    int32_t margin = (lineW > dotW ? lineW : dotW) + 1;
+
+    a.x1 = x0 + (int32_t)(w * from / (pcnt - 1)) - margin;
+    a.x2 = x0 + (int32_t)(w * to / (pcnt - 1)) + margin;
+    a.y1 -= margin;
+    a.y2 += margin;
+    lv_obj_invalidate_area(chart, &a);
+}
@@ -0,0 +1,126 @@
+#include <string.h>
+#include "LCD_DMA.h"
+#include "LCD_Console.h"
+
+static_assert(WV_RP2040_LCD_CONSOLE_COLS * (WV_RP2040_LCD_FONT_WIDTH + 1) == WV_RP2040_LCD_WIDTH,
+    "Console lines must cover the full panel width");
+static_assert(WV_RP2040_LCD_DMA_BUF_PX >= WV_RP2040_LCD_WIDTH, "A line buffer must hold a panel row");
+
+WV_RP2040::WV_RP2040_LCD_Console::WV_RP2040_LCD_Console() :
+    lines(), lineCount(0), nextSlot(0), shownCount(0), fg(0xFFFF), bg(0x0000), isActive(false) {
+}
+
+WV_RP2040::WV_RP2040_LCD_Console & WV_RP2040::WV_RP2040_LCD_Console::get_Inst() {
+    static WV_RP2040_LCD_Console __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Console::set_Scroll(uint16_t row) {
+    uint8_t vscsad[2] = { (uint8_t)(row >> 8), (uint8_t)(row & 0xFF) };
+    WV_RP2040_LCD_DMA::get_Inst().queue_Command(0x37, vscsad, sizeof(vscsad)); // Vertical scroll start address
+}
+
+void WV_RP2040::WV_RP2040_LCD_Console::paint_Line(const char *text) {
+    WV_RP2040_LCD_DMA &dma = WV_RP2040_LCD_DMA::get_Inst();
+    const WV_RP2040_LCD_GlyphAtlas &atlas = WV_RP2040_LCD_FONT_1X;
+    const uint8_t rowsPerBuf = WV_RP2040_LCD_DMA_BUF_PX / WV_RP2040_LCD_WIDTH;
+    uint16_t y = nextSlot * WV_RP2040_LCD_FONT_HEIGHT;
+
+    // One window for the whole line, rows are expanded straight into the line buffers
+    dma.queue_Window(0, y, WV_RP2040_LCD_WIDTH - 1, y + WV_RP2040_LCD_FONT_HEIGHT - 1);
+    for (uint8_t row = 0; row < WV_RP2040_LCD_FONT_HEIGHT; ) {
+        uint16_t *buf = dma.acquire_LineBuf();
+        uint32_t used = 0;
+
+        for (uint8_t n = 0; n < rowsPerBuf && row < WV_RP2040_LCD_FONT_HEIGHT; n++, row++) {
+            const char *c = text;
+            for (uint8_t col = 0; col < WV_RP2040_LCD_CONSOLE_COLS; col++) {
+                uint16_t bits = atlas.rows[WV_RP2040_LCD_GlyphAtlas::get_Glyph(*c ? *c : ' ')][row];
+                if (*c) c++;
+                for (uint16_t mask = 1u << (atlas.width - 1); mask; mask >>= 1) buf[used++] = (bits & mask) ? fg : bg;
+                buf[used++] = bg;
+            }
+        }
+        dma.queue_LineBuf(buf, used);
+    }
+
+    // Until the panel is full the lines simply stack up, then the newest one is scrolled to the bottom
+    nextSlot = (nextSlot + 1) % WV_RP2040_LCD_CONSOLE_SLOTS;
+    if (shownCount < WV_RP2040_LCD_CONSOLE_LINES) {
+        shownCount++;
+    } else {
+        uint8_t top = (nextSlot + WV_RP2040_LCD_CONSOLE_SLOTS - WV_RP2040_LCD_CONSOLE_LINES) % WV_RP2040_LCD_CONSOLE_SLOTS;
+        set_Scroll(top * WV_RP2040_LCD_FONT_HEIGHT);
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_Console::add_Line(const char *text, size_t len) {
+    char *line = lines[lineCount % WV_RP2040_LCD_CONSOLE_LINES];
+    if (len > WV_RP2040_LCD_CONSOLE_COLS) len = WV_RP2040_LCD_CONSOLE_COLS;
+    memcpy(line, text, len);
+    line[len] = '\0';
+    lineCount++;
+
+    if (isActive) paint_Line(line);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Console::begin(uint16_t setFg, uint16_t setBg) {
+    WV_RP2040_LCD_DMA &dma = WV_RP2040_LCD_DMA::get_Inst();
+    WV_RP2040_LCD &lcd = WV_RP2040_LCD::get_Inst();
+    fg = lcd.get_NativeColor(setFg);
+    bg = lcd.get_NativeColor(setBg);
+
+    // Hardware scrolling moves the frame memory rows, which only run top to bottom unturned
+    lcd.set_Orientation(WV_RP2040_LCD::ORIENT_0);
+
+    // Vertical scroll definition, no fixed areas, the whole frame memory scrolls
+    uint8_t vscrdef[6] = { 0x00, 0x00, (uint8_t)(WV_RP2040_LCD_GRAM_HEIGHT >> 8), (uint8_t)(WV_RP2040_LCD_GRAM_HEIGHT & 0xFF), 0x00, 0x00 };
+    dma.queue_Command(0x33, vscrdef, 4);
+    dma.queue_Data(vscrdef + 4, 2);
+
+    isActive = true;
+    clear();
+}
+
+void WV_RP2040::WV_RP2040_LCD_Console::end() {
+    if (!isActive) return;
+
+    WV_RP2040_LCD_DMA::get_Inst().queue_Command(0x13, NULL, 0); // Normal display mode on, leaves scrolling
+    isActive = false;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Console::print(const char *text) {
+    // Every line break or full line becomes a console line, a trailing line break adds no empty line
+    do {
+        size_t len = 0;
+        while (text[len] && text[len] != '\n' && len < WV_RP2040_LCD_CONSOLE_COLS) len++;
+        add_Line(text, len);
+
+        text += len;
+        if (*text == '\n') text++;
+    } while (*text);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Console::clear() {
+    lineCount = 0;
+    redraw();
+}
+
+void WV_RP2040::WV_RP2040_LCD_Console::redraw() {
+    if (!isActive) return;
+    WV_RP2040_LCD_DMA &dma = WV_RP2040_LCD_DMA::get_Inst();
+
+    // Clear the off screen rows too, they scroll into view later
+    dma.queue_Window(0, 0, WV_RP2040_LCD_WIDTH - 1, WV_RP2040_LCD_GRAM_HEIGHT - 1);
+    dma.queue_Fill(bg, (uint32_t)WV_RP2040_LCD_WIDTH * WV_RP2040_LCD_GRAM_HEIGHT);
+    set_Scroll(0);
+    nextSlot = 0;
+    shownCount = 0;
+
+    uint32_t n = (lineCount < WV_RP2040_LCD_CONSOLE_LINES) ? lineCount : WV_RP2040_LCD_CONSOLE_LINES;
+    for (uint32_t i = lineCount - n; i < lineCount; i++) paint_Line(lines[i % WV_RP2040_LCD_CONSOLE_LINES]);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_Console::is_Active() const {
+    return isActive;
+}
@@ -0,0 +1,288 @@
+#include "hardware/sync.h"
+#include "LCD_DMA.h"
+#include "LCD_Profiler.h"
+#if PICO_NO_HARDWARE
+#include "LCD_Emulator.h"
+#else
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "LCD_SPI.h"
+#endif
+
+static_assert((WV_RP2040_LCD_DMA_QUEUE_LEN & (WV_RP2040_LCD_DMA_QUEUE_LEN - 1)) == 0,
+    "WV_RP2040_LCD_DMA_QUEUE_LEN must be a power of two");
+
+// Bus the engine starts on, host builds talk to the ST7789 model
+static WV_RP2040::WV_RP2040_LCD_Transport & default_Transport() {
+#if PICO_NO_HARDWARE
+    return WV_RP2040::WV_RP2040_LCD_Emulator::get_Inst();
+#else
+    return WV_RP2040::WV_RP2040_LCD_SPI::get_Inst();
+#endif
+}
+
+WV_RP2040::WV_RP2040_LCD_DMA::WV_RP2040_LCD_DMA() :
+    transport(&default_Transport()), dmaChannel(-1), jobSent(0), pixelBits(16), originX(0), originY(0), jobHead(0), jobTail(0),
+    isBusy(false), nextLineBuf(0) {
+    lineBufBusy[0] = lineBufBusy[1] = false;
+    lock = spin_lock_init(spin_lock_claim_unused(true));
+
+    // Bring up the default bus of the LCD
+    transport->init();
+
+#if !PICO_NO_HARDWARE
+    // Claim the channel and hook the completion interrupt
+    dmaChannel = dma_claim_unused_channel(true);
+    dma_channel_set_irq0_enabled(dmaChannel, true);
+    irq_add_shared_handler(DMA_IRQ_0, dma_IRQHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+#endif
+}
+
+WV_RP2040::WV_RP2040_LCD_DMA & WV_RP2040::WV_RP2040_LCD_DMA::get_Inst() {
+    static WV_RP2040_LCD_DMA __instance;
+    return __instance;
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DMA::start_Chunk(const WV_RP2040_LCD_DMA_JOB &job) {
+    uint32_t n = job.count - jobSent;
+    uint32_t maxPixels = transport->get_MaxPixels();
+    if (n > maxPixels) n = maxPixels;
+
+    const uint16_t *src = (job.type == JOB_COPY) ? job.src + jobSent : &job.color;
+    jobSent += n;
+    return transport->start_Pixels(dmaChannel, src, n, job.type == JOB_COPY);
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::finish_Job() {
+    WV_RP2040_LCD_DMA_JOB &job = jobs[jobTail & (WV_RP2040_LCD_DMA_QUEUE_LEN - 1)];
+    if (job.lineBuf >= 0) lineBufBusy[job.lineBuf] = false;
+    jobSent = 0;
+    jobTail = jobTail + 1;
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::pump() {
+    while (jobTail != jobHead) {
+        WV_RP2040_LCD_DMA_JOB &job = jobs[jobTail & (WV_RP2040_LCD_DMA_QUEUE_LEN - 1)];
+
+        if (!isBusy) {
+            isBusy = true;
+            WV_RP2040_LCD_PROF_BUS(true);
+            transport->select(true);
+        }
+
+        switch (job.type) {
+        case JOB_COMMAND:
+            // Commands are short, send them right here between two transfers
+            transport->write_Bytes(false, &job.cmd, 1);
+            if (job.paramCount) transport->write_Bytes(true, job.params, job.paramCount);
+            finish_Job();
+            continue;
+
+        case JOB_DATA:
+            transport->write_Bytes(true, job.params, job.paramCount);
+            finish_Job();
+            continue;
+
+        case JOB_NOTIFY: {
+            // The slot is free once retired, keep the callback first
+            WV_RP2040_LCD_DMA_NOTIFY_CB notify = job.notify;
+            void *ctx = job.ctx;
+            finish_Job();
+            if (notify) notify(ctx);
+            continue;
+        }
+
+        default:
+            break;
+        }
+
+        // Pixel jobs go out in chunks the transport can take, the interrupt continues them
+        bool isDone = true;
+        while (isDone && jobSent < job.count) isDone = start_Chunk(job);
+        if (!isDone) return;
+        finish_Job();
+    }
+
+    if (isBusy) {
+        // Ring drained, release the bus
+        transport->wait_Bus();
+        transport->select(false);
+        WV_RP2040_LCD_PROF_BUS(false);
+        isBusy = false;
+    }
+}
+
+#if !PICO_NO_HARDWARE
+void __not_in_flash_func(WV_RP2040::WV_RP2040_LCD_DMA::dma_IRQHandler)() {
+    WV_RP2040_LCD_DMA &inst = get_Inst();
+    if (!dma_channel_get_irq0_status(inst.dmaChannel)) return;
+    dma_channel_acknowledge_irq0(inst.dmaChannel);
+
+    // Retire the job once its last chunk is out, pump continues or starts the next one
+    uint32_t irq = spin_lock_blocking(inst.lock);
+    WV_RP2040_LCD_DMA_JOB &job = inst.jobs[inst.jobTail & (WV_RP2040_LCD_DMA_QUEUE_LEN - 1)];
+    if (inst.jobSent >= job.count) inst.finish_Job();
+
+    inst.pump();
+    spin_unlock(inst.lock, irq);
+}
+#endif
+
+void WV_RP2040::WV_RP2040_LCD_DMA::push_Job(const WV_RP2040_LCD_DMA_JOB &job) {
+    // Back pressure, the interrupt frees slots as it goes
+    if (jobHead - jobTail >= WV_RP2040_LCD_DMA_QUEUE_LEN) {
+        WV_RP2040_LCD_PROF_BLOCK_BEGIN();
+        while (jobHead - jobTail >= WV_RP2040_LCD_DMA_QUEUE_LEN) tight_loop_contents();
+        WV_RP2040_LCD_PROF_BLOCK_END();
+    }
+
+#if WV_RP2040_LCD_PROFILE
+    switch (job.type) {
+    case JOB_COMMAND:   WV_RP2040_LCD_PROF_TRANSACTION(1 + job.paramCount); break;
+    case JOB_DATA:      WV_RP2040_LCD_PROF_TRANSACTION(job.paramCount); break;
+    case JOB_FILL:
+    case JOB_COPY:      WV_RP2040_LCD_PROF_TRANSACTION((job.count * pixelBits + 7) / 8); break;
+    default:            break;
+    }
+#endif
+
+    jobs[jobHead & (WV_RP2040_LCD_DMA_QUEUE_LEN - 1)] = job;
+    __dmb();
+    jobHead = jobHead + 1;
+
+    // Only kick the engine if the interrupt is not already draining the ring. The lock
+    // also keeps an interrupt on the other core from releasing the bus behind the new job
+    uint32_t irq = spin_lock_blocking(lock);
+    if (!isBusy) pump();
+    spin_unlock(lock, irq);
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::queue_Command(uint8_t cmd, const uint8_t *params, uint8_t paramCount) {
+    WV_RP2040_LCD_DMA_JOB job = {};
+    job.type = JOB_COMMAND;
+    job.cmd = cmd;
+    job.paramCount = (paramCount > sizeof(job.params)) ? sizeof(job.params) : paramCount;
+    job.lineBuf = -1;
+    for (uint8_t i = 0; i < job.paramCount; i++) job.params[i] = params[i];
+    push_Job(job);
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::queue_Data(const uint8_t *data, uint8_t count) {
+    WV_RP2040_LCD_DMA_JOB job = {};
+    job.type = JOB_DATA;
+    job.paramCount = (count > sizeof(job.params)) ? sizeof(job.params) : count;
+    job.lineBuf = -1;
+    for (uint8_t i = 0; i < job.paramCount; i++) job.params[i] = data[i];
+    if (job.paramCount) push_Job(job);
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::queue_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    x0 += originX; x1 += originX;
+    y0 += originY; y1 += originY;
+    uint8_t caset[4] = { (uint8_t)(x0 >> 8), (uint8_t)(x0 & 0xFF), (uint8_t)(x1 >> 8), (uint8_t)(x1 & 0xFF) };
+    uint8_t raset[4] = { (uint8_t)(y0 >> 8), (uint8_t)(y0 & 0xFF), (uint8_t)(y1 >> 8), (uint8_t)(y1 & 0xFF) };
+
+    queue_Command(0x2A, caset, sizeof(caset)); // Column address set
+    queue_Command(0x2B, raset, sizeof(raset)); // Row address set
+    queue_Command(0x2C, NULL, 0); // Memory write
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::queue_Fill(uint16_t color, uint32_t count) {
+    if (!count) return;
+
+    WV_RP2040_LCD_DMA_JOB job = {};
+    job.type = JOB_FILL;
+    job.lineBuf = -1;
+    job.color = color;
+    job.count = count;
+    push_Job(job);
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::queue_Copy(const uint16_t *src, uint32_t count) {
+    if (!count) return;
+
+    WV_RP2040_LCD_DMA_JOB job = {};
+    job.type = JOB_COPY;
+    job.lineBuf = -1;
+    job.src = src;
+    job.count = count;
+    push_Job(job);
+}
+
+uint16_t * WV_RP2040::WV_RP2040_LCD_DMA::acquire_LineBuf() {
+    uint8_t i = nextLineBuf;
+    if (lineBufBusy[i]) {
+        WV_RP2040_LCD_PROF_BLOCK_BEGIN();
+        while (lineBufBusy[i]) tight_loop_contents();
+        WV_RP2040_LCD_PROF_BLOCK_END();
+    }
+    lineBufBusy[i] = true;
+    nextLineBuf = i ^ 1;
+    return lineBufs[i];
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::queue_LineBuf(uint16_t *buf, uint32_t count) {
+    int8_t i = (buf == lineBufs[0]) ? 0 : 1;
+    if (!count) {
+        lineBufBusy[i] = false;
+        return;
+    }
+
+    WV_RP2040_LCD_DMA_JOB job = {};
+    job.type = JOB_COPY;
+    job.lineBuf = i;
+    job.src = buf;
+    job.count = (count > WV_RP2040_LCD_DMA_BUF_PX) ? WV_RP2040_LCD_DMA_BUF_PX : count;
+    push_Job(job);
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::queue_Notify(WV_RP2040_LCD_DMA_NOTIFY_CB cb, void *ctx) {
+    WV_RP2040_LCD_DMA_JOB job = {};
+    job.type = JOB_NOTIFY;
+    job.lineBuf = -1;
+    job.notify = cb;
+    job.ctx = ctx;
+    push_Job(job);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DMA::is_Idle() const {
+    return !isBusy;
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::wait_Idle() {
+    if (!isBusy) return;
+
+    WV_RP2040_LCD_PROF_BLOCK_BEGIN();
+    while (isBusy) tight_loop_contents();
+    WV_RP2040_LCD_PROF_BLOCK_END();
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::set_Transport(WV_RP2040_LCD_Transport &newTransport) {
+    wait_Idle();
+    if (transport == &newTransport) return;
+
+    transport->deinit();
+    transport = &newTransport;
+    transport->init();
+    transport->set_PixelBits(pixelBits);
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::set_PixelBits(uint8_t bits) {
+    wait_Idle();
+    pixelBits = (bits == 12) ? 12 : 16;
+    transport->set_PixelBits(pixelBits);
+}
+
+uint8_t WV_RP2040::WV_RP2040_LCD_DMA::get_PixelBits() const {
+    return pixelBits;
+}
+
+void WV_RP2040::WV_RP2040_LCD_DMA::set_Origin(uint16_t x, uint16_t y) {
+    originX = x;
+    originY = y;
+}
+
+WV_RP2040::WV_RP2040_LCD_Transport & WV_RP2040::WV_RP2040_LCD_DMA::get_Transport() const {
+    return *transport;
+}
@@ -0,0 +1,95 @@
+#include "LCD_Damage.h"
+
+WV_RP2040::WV_RP2040_LCD_Damage::WV_RP2040_LCD_Damage() :
+    count(0), cap(WV_RP2040_LCD_DAMAGE_MAX_RECTS) {
+}
+
+bool WV_RP2040::WV_RP2040_LCD_Damage::can_Merge(const WV_RP2040_LCD_RECT &a, const WV_RP2040_LCD_RECT &b) {
+    // Grow a by one pixel so that touching rectangles count as well
+    return (int)b.x0 <= a.x1 + 1 && (int)a.x0 <= b.x1 + 1 &&
+           (int)b.y0 <= a.y1 + 1 && (int)a.y0 <= b.y1 + 1;
+}
+
+WV_RP2040::WV_RP2040_LCD_RECT WV_RP2040::WV_RP2040_LCD_Damage::get_Union(const WV_RP2040_LCD_RECT &a, const WV_RP2040_LCD_RECT &b) {
+    WV_RP2040_LCD_RECT r;
+    r.x0 = (a.x0 < b.x0) ? a.x0 : b.x0;
+    r.y0 = (a.y0 < b.y0) ? a.y0 : b.y0;
+    r.x1 = (a.x1 > b.x1) ? a.x1 : b.x1;
+    r.y1 = (a.y1 > b.y1) ? a.y1 : b.y1;
+    return r;
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_Damage::get_Area(const WV_RP2040_LCD_RECT &r) {
+    return (uint32_t)(r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Damage::remove(uint8_t index) {
+    rects[index] = rects[--count];
+}
+
+void WV_RP2040::WV_RP2040_LCD_Damage::set_Cap(uint8_t newCap) {
+    if (newCap < 1) newCap = 1;
+    if (newCap > WV_RP2040_LCD_DAMAGE_MAX_RECTS) newCap = WV_RP2040_LCD_DAMAGE_MAX_RECTS;
+    cap = newCap;
+
+    // Squeeze the already recorded rectangles under the new cap
+    while (count > cap) {
+        WV_RP2040_LCD_RECT last = rects[--count];
+        add(last);
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_Damage::add(const WV_RP2040_LCD_RECT &rect) {
+    WV_RP2040_LCD_RECT r = rect;
+
+    // Absorb every rectangle the new one touches, the grown one may touch more
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (uint8_t i = 0; i < count; i++) {
+            if (can_Merge(rects[i], r)) {
+                r = get_Union(rects[i], r);
+                remove(i);
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (count < cap) {
+        rects[count++] = r;
+        return;
+    }
+
+    // Out of room, merge into the rectangle which grows the least
+    uint8_t best = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (uint8_t i = 0; i < count; i++) {
+        uint32_t growth = get_Area(get_Union(rects[i], r)) - get_Area(rects[i]);
+        if (growth < bestGrowth) {
+            bestGrowth = growth;
+            best = i;
+        }
+    }
+    r = get_Union(rects[best], r);
+    remove(best);
+    add(r);
+}
+
+uint8_t WV_RP2040::WV_RP2040_LCD_Damage::get_Count() const {
+    return count;
+}
+
+const WV_RP2040::WV_RP2040_LCD_RECT & WV_RP2040::WV_RP2040_LCD_Damage::get_Rect(uint8_t index) const {
+    return rects[index];
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_Damage::get_DamagedArea() const {
+    uint32_t area = 0;
+    for (uint8_t i = 0; i < count; i++) area += get_Area(rects[i]);
+    return area;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Damage::clear() {
+    count = 0;
+}
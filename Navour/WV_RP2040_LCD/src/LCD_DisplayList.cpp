@@ -0,0 +1,220 @@
+#include <string.h>
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "LCD_DisplayList.h"
+
+static_assert(WV_RP2040_LCD_DL_BUF_BYTES <= 0xFFFF, "The FIFO message holds the frame length in 16 bits");
+
+// int16_t arguments following each opcode, the polygons and the text carry trailing bytes
+static const uint8_t argCounts[] = { 1, 3, 5, 5, 6, 6, 4, 4, 7, 7, 2, 2, 5, 1 };
+
+WV_RP2040::WV_RP2040_LCD_DisplayList::WV_RP2040_LCD_DisplayList() :
+    bufs(), bufBusy(), recBuf(0), recLen(0), isStarted(false), transport(WV_RP2040_LCD::TRANSPORT_SPI) {
+}
+
+WV_RP2040::WV_RP2040_LCD_DisplayList & WV_RP2040::WV_RP2040_LCD_DisplayList::get_Inst() {
+    static WV_RP2040_LCD_DisplayList __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_DisplayList::core1_Main() {
+    WV_RP2040_LCD_DisplayList &dl = get_Inst();
+    WV_RP2040_LCD &lcd = WV_RP2040_LCD::get_Inst();
+
+    lcd.initialize_LCD(dl.transport);
+    multicore_fifo_push_blocking(0);
+
+    while (true) {
+        uint32_t msg = multicore_fifo_pop_blocking();
+        dl.execute(dl.bufs[msg >> 16], msg & 0xFFFF);
+        multicore_fifo_push_blocking(msg);
+    }
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::start(WV_RP2040_LCD::WV_RP2040_LCD_TRANSPORT setTransport) {
+    if (isStarted) return true;
+
+    // The LVGL draw threads may hold core1 already
+    if (!WV_RP2040_LCD::claim_Core1(WV_RP2040_LCD::CORE1_DISPLAY_LIST)) return false;
+
+    transport = setTransport;
+    multicore_launch_core1(core1_Main);
+    (void)multicore_fifo_pop_blocking(); // LCD ready
+    isStarted = true;
+    return true;
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::record(uint8_t op, const int16_t *args, uint8_t argCount, const void *extra, size_t extraLen) {
+    // Entries stay 16 bit aligned, so the renderer can read the points in place
+    uint32_t len = sizeof(uint16_t) * (1 + argCount) + ((extraLen + 1) & ~(size_t)1);
+    if (recLen + len > WV_RP2040_LCD_DL_BUF_BYTES) return false;
+
+    uint8_t *dst = bufs[recBuf] + recLen;
+    uint16_t op16 = op;
+    memcpy(dst, &op16, sizeof(op16));
+    memcpy(dst + sizeof(op16), args, argCount * sizeof(int16_t));
+    if (extraLen) memcpy(dst + sizeof(op16) + argCount * sizeof(int16_t), extra, extraLen);
+    recLen += len;
+    return true;
+}
+
+void WV_RP2040::WV_RP2040_LCD_DisplayList::wait_Buffer(uint8_t buf) {
+    // Frames are answered in the order they were handed over
+    while (bufBusy[buf]) {
+        uint32_t msg = multicore_fifo_pop_blocking();
+        bufBusy[msg >> 16] = false;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_DisplayList::end_Frame() {
+    if (recLen == 0) return;
+
+    if (!isStarted) {
+        // No renderer, draw on the calling core
+        execute(bufs[recBuf], recLen);
+        recLen = 0;
+        return;
+    }
+
+    bufBusy[recBuf] = true;
+    __dmb();
+    multicore_fifo_push_blocking(((uint32_t)recBuf << 16) | recLen);
+
+    recBuf ^= 1;
+    recLen = 0;
+    wait_Buffer(recBuf);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::is_FramePending() {
+    while (multicore_fifo_rvalid()) {
+        uint32_t msg = multicore_fifo_pop_blocking();
+        bufBusy[msg >> 16] = false;
+    }
+    return bufBusy[0] || bufBusy[1];
+}
+
+void WV_RP2040::WV_RP2040_LCD_DisplayList::wait_Frames() {
+    wait_Buffer(0);
+    wait_Buffer(1);
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_DisplayList::get_Used() const {
+    return recLen;
+}
+
+void WV_RP2040::WV_RP2040_LCD_DisplayList::execute(const uint8_t *cmds, uint32_t len) {
+    WV_RP2040_LCD &lcd = WV_RP2040_LCD::get_Inst();
+    uint32_t pos = 0;
+
+    while (pos < len) {
+        uint16_t op;
+        int16_t a[7];
+        memcpy(&op, cmds + pos, sizeof(op));
+        if (op >= sizeof(argCounts)) break;
+        memcpy(a, cmds + pos + sizeof(op), argCounts[op] * sizeof(int16_t));
+        pos += sizeof(op) + argCounts[op] * sizeof(int16_t);
+
+        const uint8_t *extra = cmds + pos;
+        switch (op) {
+        case OP_CLEAR:              lcd.clear_Screen(a[0]); break;
+        case OP_PIXEL:              lcd.draw_Rectangle(a[0], a[1], 1, 1, a[2]); break;
+        case OP_LINE:               lcd.draw_Line(a[0], a[1], a[2], a[3], a[4]); break;
+        case OP_RECT:               lcd.draw_Rectangle(a[0], a[1], a[2], a[3], a[4]); break;
+        case OP_ROUND_RECT:         lcd.draw_RoundRect(a[0], a[1], a[2], a[3], a[4], a[5]); break;
+        case OP_FILL_ROUND_RECT:    lcd.fill_RoundRect(a[0], a[1], a[2], a[3], a[4], a[5]); break;
+        case OP_CIRCLE:             lcd.draw_Circle(a[0], a[1], a[2], a[3]); break;
+        case OP_FILL_CIRCLE:        lcd.fill_Circle(a[0], a[1], a[2], a[3]); break;
+        case OP_TRIANGLE:           lcd.draw_Triangle(a[0], a[1], a[2], a[3], a[4], a[5], a[6]); break;
+        case OP_FILL_TRIANGLE:      lcd.fill_Triangle(a[0], a[1], a[2], a[3], a[4], a[5], a[6]); break;
+        case OP_POLYGON:
+        case OP_FILL_POLYGON: {
+            const WV_RP2040_LCD_POINT *pts = (const WV_RP2040_LCD_POINT *)extra;
+            uint16_t count = (uint16_t)a[1];
+            if (op == OP_POLYGON) lcd.draw_Polygon(pts, count, a[0]);
+            else lcd.fill_Polygon(pts, count, a[0]);
+            pos += count * sizeof(WV_RP2040_LCD_POINT);
+            break;
+        }
+        case OP_TEXT: {
+            size_t textLen = strlen((const char *)extra) + 1;
+            lcd.draw_String(a[0], a[1], (const char *)extra, a[2], a[3], (uint8_t)a[4]);
+            pos += (textLen + 1) & ~(size_t)1;
+            break;
+        }
+        case OP_BACKLIGHT:          lcd.set_Backlight(a[0] != 0); break;
+        }
+    }
+
+    // The frame is done once it left the bus
+    lcd.wait_Idle();
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::clear_Screen(uint16_t color) {
+    const int16_t args[] = { (int16_t)color };
+    return record(OP_CLEAR, args, 1);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::draw_Pixel(int16_t x, int16_t y, uint16_t color) {
+    const int16_t args[] = { x, y, (int16_t)color };
+    return record(OP_PIXEL, args, 3);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::draw_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    const int16_t args[] = { x0, y0, x1, y1, (int16_t)color };
+    return record(OP_LINE, args, 5);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::draw_Rectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    const int16_t args[] = { x, y, (int16_t)w, (int16_t)h, (int16_t)color };
+    return record(OP_RECT, args, 5);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::draw_RoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
+    const int16_t args[] = { x, y, (int16_t)w, (int16_t)h, (int16_t)r, (int16_t)color };
+    return record(OP_ROUND_RECT, args, 6);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::fill_RoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
+    const int16_t args[] = { x, y, (int16_t)w, (int16_t)h, (int16_t)r, (int16_t)color };
+    return record(OP_FILL_ROUND_RECT, args, 6);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::draw_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color) {
+    const int16_t args[] = { cx, cy, (int16_t)r, (int16_t)color };
+    return record(OP_CIRCLE, args, 4);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::fill_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color) {
+    const int16_t args[] = { cx, cy, (int16_t)r, (int16_t)color };
+    return record(OP_FILL_CIRCLE, args, 4);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::draw_Triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    const int16_t args[] = { x0, y0, x1, y1, x2, y2, (int16_t)color };
+    return record(OP_TRIANGLE, args, 7);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::fill_Triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    const int16_t args[] = { x0, y0, x1, y1, x2, y2, (int16_t)color };
+    return record(OP_FILL_TRIANGLE, args, 7);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::draw_Polygon(const WV_RP2040_LCD_POINT *pts, uint16_t count, uint16_t color) {
+    const int16_t args[] = { (int16_t)color, (int16_t)count };
+    return record(OP_POLYGON, args, 2, pts, count * sizeof(WV_RP2040_LCD_POINT));
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::fill_Polygon(const WV_RP2040_LCD_POINT *pts, uint16_t count, uint16_t color) {
+    const int16_t args[] = { (int16_t)color, (int16_t)count };
+    return record(OP_FILL_POLYGON, args, 2, pts, count * sizeof(WV_RP2040_LCD_POINT));
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::draw_String(int16_t x, int16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t scale) {
+    const int16_t args[] = { x, y, (int16_t)color, (int16_t)bg, (int16_t)scale };
+    return record(OP_TEXT, args, 5, str, strlen(str) + 1);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DisplayList::set_Backlight(bool setOn) {
+    const int16_t args[] = { (int16_t)setOn };
+    return record(OP_BACKLIGHT, args, 1);
+}
@@ -0,0 +1,211 @@
+#include <string.h>
+#include "lvgl_private.h"
+#include "LCD_DMA.h"
+#include "LCD_Profiler.h"
+#include "LCD_DrawUnit.h"
+
+#if LVGL_VERSION_MAJOR != 9 || LVGL_VERSION_MINOR != 3
+#error "LCD_DrawUnit.cpp uses LVGL internals checked against v9.3, check them before moving the pin"
+#endif
+
+WV_RP2040::WV_RP2040_LCD_DrawUnit::WV_RP2040_LCD_DrawUnit() :
+    unit(NULL), layer(NULL), ops(), opCount(0), neededRows(), stats() {
+}
+
+WV_RP2040::WV_RP2040_LCD_DrawUnit & WV_RP2040::WV_RP2040_LCD_DrawUnit::get_Inst() {
+    static WV_RP2040_LCD_DrawUnit __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_DrawUnit::attach() {
+    if (unit) return;
+    unit = (lv_draw_unit_t *)lv_draw_create_unit(sizeof(lv_draw_unit_t));
+    unit->evaluate_cb = evaluate_CB;
+    unit->dispatch_cb = dispatch_CB;
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DrawUnit::claim(const lv_draw_task_t *t, WV_RP2040_LCD_DRAW_OP &op) const {
+    lv_area_t a;
+    if (!lv_area_intersect(&a, &t->area, &t->clip_area)) return false;
+
+    if (t->type == LV_DRAW_TASK_TYPE_FILL) {
+        const lv_draw_fill_dsc_t *d = (const lv_draw_fill_dsc_t *)t->draw_dsc;
+        if (d->opa < LV_OPA_MAX || d->radius != 0 || d->grad.dir != LV_GRAD_DIR_NONE) return false;
+        op = { t, a, NULL, 0, 0, 0, lv_color_to_u16(d->color), false };
+        return true;
+    }
+
+    if (t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        const lv_draw_image_dsc_t *d = (const lv_draw_image_dsc_t *)t->draw_dsc;
+        if (d->opa < LV_OPA_MAX || d->rotation != 0 || d->scale_x != LV_SCALE_NONE || d->scale_y != LV_SCALE_NONE ||
+            d->skew_x != 0 || d->skew_y != 0 || d->recolor_opa > LV_OPA_MIN || d->blend_mode != LV_BLEND_MODE_NORMAL ||
+            d->clip_radius != 0 || d->bitmap_mask_src || d->tile) return false;
+        if (lv_image_src_get_type(d->src) != LV_IMAGE_SRC_VARIABLE) return false;
+
+        // Only plain RGB565 pixels in memory, one to one on the screen
+        const lv_image_dsc_t *img = (const lv_image_dsc_t *)d->src;
+        if (img->header.cf != LV_COLOR_FORMAT_RGB565 || (img->header.flags & LV_IMAGE_FLAGS_COMPRESSED) || !img->data) return false;
+        if (lv_area_get_width(&t->area) != (int32_t)img->header.w || lv_area_get_height(&t->area) != (int32_t)img->header.h) return false;
+
+        uint32_t stride = img->header.stride ? img->header.stride : img->header.w * 2;
+        op = { t, a, img->data, stride, t->area.x1, t->area.y1, 0, false };
+        return true;
+    }
+    return false;
+}
+
+int32_t WV_RP2040::WV_RP2040_LCD_DrawUnit::evaluate_CB(lv_draw_unit_t *u, lv_draw_task_t *t) {
+    WV_RP2040_LCD_DrawUnit &self = get_Inst();
+
+    // Child layers are composed into the display layer by a task of their own
+    const lv_draw_dsc_base_t *base = (const lv_draw_dsc_base_t *)t->draw_dsc;
+    lv_layer_t *target = base ? base->layer : NULL;
+    if (!target || target->parent || !target->draw_buf) return 0;
+    if (!self.layer) self.layer = target;
+    if (target != self.layer) return 0;
+
+    WV_RP2040_LCD_DRAW_OP op;
+    if (self.opCount < WV_RP2040_LCD_DRAW_OPS && self.claim(t, op)) {
+        t->preferred_draw_unit_id = u->idx;
+        t->preference_score = 0;
+        self.ops[self.opCount++] = op;
+        return 0;
+    }
+
+    // Drawn by the software unit, these rows are flushed from the buffer
+    lv_area_t a;
+    if (lv_area_intersect(&a, &t->_real_area, &t->clip_area)) self.mark_Rows(a.y1, a.y2);
+    return 0;
+}
+
+int32_t WV_RP2040::WV_RP2040_LCD_DrawUnit::dispatch_CB(lv_draw_unit_t *u, lv_layer_t *layer) {
+    WV_RP2040_LCD_DrawUnit &self = get_Inst();
+    if (layer != self.layer) return LV_DRAW_UNIT_IDLE;
+
+    lv_draw_task_t *t = lv_draw_get_available_task(layer, NULL, u->idx);
+    if (!t || t->preferred_draw_unit_id != u->idx) return LV_DRAW_UNIT_IDLE;
+
+    WV_RP2040_LCD_DRAW_OP *op = NULL;
+    for (uint8_t i = 0; i < self.opCount && !op; i++) {
+        if (self.ops[i].task == t) op = &self.ops[i];
+    }
+    if (!op) return LV_DRAW_UNIT_IDLE;
+
+    WV_RP2040_LCD_PROF_SCOPE(PROF_LVGL);
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+    // Rows flushed anyway get the task in the buffer, the others are drawn on the panel
+    int32_t y1 = op->area.y1, band = layer->buf_area.y1;
+    while (y1 <= op->area.y2) {
+        bool isNeeded = self.is_Needed(y1 - band);
+        int32_t y2 = y1;
+        while (y2 < op->area.y2 && self.is_Needed(y2 + 1 - band) == isNeeded) y2++;
+        if (isNeeded) self.paint(*op, y1, y2);
+        else self.send(*op, y1, y2);
+        y1 = y2 + 1;
+    }
+    op->isDone = true;
+    if (op->src) self.stats.images++;
+    else self.stats.fills++;
+
+    t->state = LV_DRAW_TASK_STATE_READY;
+    lv_draw_dispatch_request();
+    return 1;
+}
+
+void WV_RP2040::WV_RP2040_LCD_DrawUnit::mark_Rows(int32_t y1, int32_t y2) {
+    int32_t band = layer->buf_area.y1;
+    if (y1 < band) y1 = band;
+    if (y2 > layer->buf_area.y2) y2 = layer->buf_area.y2;
+
+    for (int32_t y = y1; y <= y2; y++) {
+        int32_t row = y - band;
+        if (is_Needed(row)) continue;
+        neededRows[row >> 5] |= 1u << (row & 31);
+
+        // Only direct tasks drew into the row so far, on the panel, the buffer catches up
+        for (uint8_t i = 0; i < opCount; i++) {
+            const WV_RP2040_LCD_DRAW_OP &op = ops[i];
+            if (op.isDone && y >= op.area.y1 && y <= op.area.y2) paint(op, y, y);
+        }
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_DrawUnit::paint(const WV_RP2040_LCD_DRAW_OP &op, int32_t y1, int32_t y2) {
+    uint16_t *buf = (uint16_t *)layer->draw_buf->data;
+    uint32_t stride = layer->draw_buf->header.stride / sizeof(uint16_t);
+    int32_t w = op.area.x2 - op.area.x1 + 1;
+
+    for (int32_t y = y1; y <= y2; y++) {
+        uint16_t *dst = buf + (y - layer->buf_area.y1) * stride + (op.area.x1 - layer->buf_area.x1);
+        if (op.src) {
+            const uint16_t *src = (const uint16_t *)(op.src + (y - op.srcY) * op.stride) + (op.area.x1 - op.srcX);
+            memcpy(dst, src, w * sizeof(uint16_t));
+        } else {
+            for (int32_t x = 0; x < w; x++) dst[x] = op.color;
+        }
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_DrawUnit::send(const WV_RP2040_LCD_DRAW_OP &op, int32_t y1, int32_t y2) {
+    WV_RP2040_LCD_DMA &dma = WV_RP2040_LCD_DMA::get_Inst();
+    WV_RP2040_LCD_COLOR_MODE mode = WV_RP2040_LCD::get_Inst().get_ColorMode();
+    uint32_t w = op.area.x2 - op.area.x1 + 1;
+
+    dma.queue_Window(op.area.x1, y1, op.area.x2, y2);
+    if (!op.src) {
+        // One repeated source word, no pixels in RAM at all
+        dma.queue_Fill(get_Native(op.color, mode), w * (y2 - y1 + 1));
+        return;
+    }
+
+    const uint16_t *src = (const uint16_t *)(op.src + (y1 - op.srcY) * op.stride) + (op.area.x1 - op.srcX);
+    if (mode == COLOR_RGB565 && op.stride == w * sizeof(uint16_t)) {
+        // Whole rows of the image, one transfer straight from its pixels
+        dma.queue_Copy(src, w * (y2 - y1 + 1));
+        return;
+    }
+    for (int32_t y = y1; y <= y2; y++) {
+        if (mode == COLOR_RGB565) dma.queue_Copy(src, w);
+        else {
+            uint16_t *buf = dma.acquire_LineBuf();
+            convert_RGB444(buf, src, w);
+            dma.queue_LineBuf(buf, w);
+        }
+        src = (const uint16_t *)((const uint8_t *)src + op.stride);
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_DrawUnit::prepare_Flush(const lv_area_t *area) {
+    if (!layer) {
+        stats.rowsFlushed += lv_area_get_height(area);
+        return;
+    }
+
+    // A row is left out only if one direct task covers it in full
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        bool isCovered = false;
+        for (uint8_t i = 0; i < opCount && !isCovered; i++) {
+            const lv_area_t &a = ops[i].area;
+            isCovered = a.x1 <= area->x1 && a.x2 >= area->x2 && y >= a.y1 && y <= a.y2;
+        }
+        if (!isCovered) mark_Rows(y, y);
+
+        if (is_Needed(y - layer->buf_area.y1)) stats.rowsFlushed++;
+        else stats.rowsSkipped++;
+    }
+}
+
+bool WV_RP2040::WV_RP2040_LCD_DrawUnit::is_RowFlushed(int32_t y) const {
+    return !layer || is_Needed(y - layer->buf_area.y1);
+}
+
+void WV_RP2040::WV_RP2040_LCD_DrawUnit::end_Band() {
+    layer = NULL;
+    opCount = 0;
+    memset(neededRows, 0, sizeof(neededRows));
+}
+
+const WV_RP2040::WV_RP2040_LCD_DRAW_STATS & WV_RP2040::WV_RP2040_LCD_DrawUnit::get_Stats() const {
+    return stats;
+}
@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <string.h>
+#include "LCD_Emulator.h"
+
+#define MADCTL_MY 0x80 // Row address order
+#define MADCTL_MX 0x40 // Column address order
+#define MADCTL_MV 0x20 // Row/column exchange
+
+WV_RP2040::WV_RP2040_LCD_Emulator::WV_RP2040_LCD_Emulator() : pixelBits(16), isDC(true) {
+    reset();
+}
+
+WV_RP2040::WV_RP2040_LCD_Emulator & WV_RP2040::WV_RP2040_LCD_Emulator::get_Inst() {
+    static WV_RP2040_LCD_Emulator __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::reset() {
+    memset(gram, 0, sizeof(gram));
+    cmd = 0x00;
+    paramIdx = 0;
+    madctl = 0x00;
+    xs = 0; xe = WV_RP2040_LCD_EMU_GRAM_WIDTH - 1;
+    ys = 0; ye = WV_RP2040_LCD_EMU_GRAM_HEIGHT - 1;
+    curX = 0; curY = 0;
+    tfa = 0; vsa = WV_RP2040_LCD_EMU_GRAM_HEIGHT; vsp = 0;
+    isScrolling = false;
+    colmod = 0x55; // Reset default is 18 bit, the driver always selects its format
+    bitAcc = 0; bitCount = 0; isHalfByte = false;
+    reset_Stats();
+}
+
+uint16_t WV_RP2040::WV_RP2040_LCD_Emulator::get_Pixel(uint16_t x, uint16_t y) const {
+    if (x >= WV_RP2040_LCD_EMU_GRAM_WIDTH || y >= WV_RP2040_LCD_EMU_GRAM_HEIGHT) return 0;
+    return gram[y][x];
+}
+
+uint16_t WV_RP2040::WV_RP2040_LCD_Emulator::get_DisplayRow(uint16_t y) const {
+    // Only the scroll area moves, the fixed areas above and below it stay put
+    if (!isScrolling || y < tfa || y >= tfa + vsa || vsa == 0) return y;
+    uint16_t start = (vsp >= tfa && vsp < tfa + vsa) ? vsp - tfa : 0;
+    return tfa + (y - tfa + start) % vsa;
+}
+
+bool WV_RP2040::WV_RP2040_LCD_Emulator::dump_PPM(const char *path, uint16_t w, uint16_t h) const {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+
+    fprintf(f, "P6\n%u %u\n255\n", w, h);
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            uint16_t c = get_Pixel(x, get_DisplayRow(y));
+            uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+            uint8_t rgb[3] = { (uint8_t)((r << 3) | (r >> 2)), (uint8_t)((g << 2) | (g >> 4)), (uint8_t)((b << 3) | (b >> 2)) };
+            fwrite(rgb, 1, sizeof(rgb), f);
+        }
+    }
+    return fclose(f) == 0;
+}
+
+const WV_RP2040::WV_RP2040_LCD_EMU_STATS & WV_RP2040::WV_RP2040_LCD_Emulator::get_Stats() const {
+    return stats;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::reset_Stats() {
+    memset(&stats, 0, sizeof(stats));
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::set_DC(bool setData) {
+    if (setData != isDC) stats.dcFlips++;
+    isDC = setData;
+}
+
+uint16_t * WV_RP2040::WV_RP2040_LCD_Emulator::step_Pointer() {
+    // The memory pointer walks the window, MADCTL maps it onto GRAM
+    uint16_t x = curX, y = curY;
+    if (madctl & MADCTL_MV) { uint16_t t = x; x = y; y = t; }
+    if (madctl & MADCTL_MX) x = WV_RP2040_LCD_EMU_GRAM_WIDTH - 1 - x;
+    if (madctl & MADCTL_MY) y = WV_RP2040_LCD_EMU_GRAM_HEIGHT - 1 - y;
+
+    if (curX++ >= xe) {
+        curX = xs;
+        curY = (curY >= ye) ? ys : curY + 1;
+    }
+    return (x < WV_RP2040_LCD_EMU_GRAM_WIDTH && y < WV_RP2040_LCD_EMU_GRAM_HEIGHT) ? &gram[y][x] : NULL;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::write_Pixel(uint16_t color) {
+    uint16_t *cell = step_Pointer();
+    if (cell) *cell = color;
+    stats.pixels++;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::data_Byte(uint8_t b) {
+    switch (cmd) {
+    case 0x2A: // Column address set
+    case 0x2B: // Row address set
+        if (paramIdx < 4) params[paramIdx++] = b;
+        if (paramIdx == 4) {
+            uint16_t s = (params[0] << 8) | params[1], e = (params[2] << 8) | params[3];
+            if (cmd == 0x2A) { xs = s; xe = e; }
+            else { ys = s; ye = e; }
+            paramIdx++;
+        }
+        break;
+
+    case 0x2C: // Memory write
+        params[paramIdx++] = b;
+        if ((colmod & 0x07) == 0x03) {
+            // RGB444, three bytes carry two pixels, the first one is complete after two
+            if (paramIdx == 2) write_Pixel(to_RGB565((uint16_t)((params[0] << 4) | (params[1] >> 4))));
+            if (paramIdx == 3) {
+                write_Pixel(to_RGB565((uint16_t)(((params[1] & 0x0F) << 8) | params[2])));
+                paramIdx = 0;
+            }
+        } else if (paramIdx == 2) {
+            write_Pixel((uint16_t)((params[0] << 8) | params[1]));
+            paramIdx = 0;
+        }
+        break;
+
+    case 0x3A: // Interface pixel format
+        colmod = b;
+        break;
+
+    case 0x36: // Memory data access control
+        madctl = b;
+        break;
+
+    case 0x33: // Vertical scroll definition
+        if (paramIdx < 6) params[paramIdx++] = b;
+        if (paramIdx == 6) {
+            tfa = (params[0] << 8) | params[1];
+            vsa = (params[2] << 8) | params[3];
+            paramIdx++;
+        }
+        break;
+
+    case 0x37: // Vertical scroll start address
+        if (paramIdx < 2) params[paramIdx++] = b;
+        if (paramIdx == 2) {
+            vsp = (params[0] << 8) | params[1];
+            isScrolling = true;
+            paramIdx++;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::stream_Bits(uint16_t value, uint8_t bits) {
+    bitAcc = (bitAcc << bits) | (value & ((1u << bits) - 1));
+    bitCount += bits;
+    while (bitCount >= 8) {
+        bitCount -= 8;
+        stats.bytes++;
+        if (cmd == 0x2C) data_Byte((uint8_t)(bitAcc >> bitCount));
+    }
+    bitAcc &= (1u << bitCount) - 1;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::put_Nibble() {
+    stream_Bits(0, 4);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::init() {
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::deinit() {
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::select(bool setSelected) {
+    if (setSelected) stats.csAssertions++;
+    else pad_Byte();
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::write_Bytes(bool isData, const uint8_t *data, size_t len) {
+    pad_Byte();
+    set_DC(isData);
+    stats.transactions++;
+    stats.bytes += len;
+
+    for (size_t i = 0; i < len; i++) {
+        if (!isData) {
+            cmd = data[i];
+            paramIdx = 0;
+            stats.commands++;
+            if (cmd == 0x01) {
+                // Software reset, the counters keep running
+                WV_RP2040_LCD_EMU_STATS keep = stats;
+                reset();
+                stats = keep;
+            }
+            if (cmd == 0x2C || cmd == 0x2E) { curX = xs; curY = ys; }
+            if (cmd == 0x13) isScrolling = false; // Normal display mode on
+        } else {
+            data_Byte(data[i]);
+        }
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::read_Bytes(uint8_t *data, size_t len, uint8_t dummyBits) {
+    stats.transactions++;
+    stats.bytes += len + dummyBits / 8;
+
+    // Only a memory read answers, one RGB666 pixel in three bytes, channels left aligned
+    for (size_t i = 0; i < len; i++) {
+        if (cmd != 0x2E) { data[i] = 0x00; continue; }
+
+        if (paramIdx == 0) {
+            uint16_t *cell = step_Pointer();
+            uint16_t c = cell ? *cell : 0;
+            params[0] = (uint8_t)(((c >> 11) & 0x1F) << 3);
+            params[1] = (uint8_t)(((c >> 5) & 0x3F) << 2);
+            params[2] = (uint8_t)((c & 0x1F) << 3);
+            stats.pixels++;
+        }
+        data[i] = params[paramIdx];
+        paramIdx = (paramIdx + 1) % 3;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::set_PixelBits(uint8_t bits) {
+    pixelBits = (bits == 12) ? 12 : 16;
+}
+
+bool WV_RP2040::WV_RP2040_LCD_Emulator::start_Pixels(int dmaChannel, const uint16_t *src, uint32_t count, bool increment) {
+    set_DC(true);
+    stats.transactions++;
+
+    // Pixels are frames of pixelBits, only meaningful after a memory write
+    for (uint32_t i = 0; i < count; i++) stream_Bits(increment ? src[i] : *src, pixelBits);
+    count_Pixels(pixelBits, count);
+    return true;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Emulator::wait_Bus() {
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_Emulator::get_MaxPixels() const {
+    return UINT32_MAX;
+}
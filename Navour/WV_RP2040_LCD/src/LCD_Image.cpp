@@ -0,0 +1,13 @@
+#include "LCD_Image.h"
+
+void WV_RP2040::WV_RP2040_LCD_ImageReader::skip(uint32_t count) {
+    while (count) {
+        if (!left && !load_Packet()) return;
+
+        // Literal pixels are stepped over by their size, runs only by their count
+        uint8_t n = (count < left) ? (uint8_t)count : left;
+        if (!isRun) src += 2 * n;
+        left -= n;
+        count -= n;
+    }
+}
@@ -0,0 +1,135 @@
+#include "hardware/sync.h"
+#include "LCD_DMA.h"
+#include "LCD_Profiler.h"
+#include "LCD_DrawUnit.h"
+#include "LCD_LVGL.h"
+
+WV_RP2040::WV_RP2040_LCD_LVGL::WV_RP2040_LCD_LVGL() :
+    display(NULL), tickTimer(), dueIn(0), isDue(true), isHandling(false) {
+    if (!lv_is_initialized()) lv_init();
+    WV_RP2040_LCD_DrawUnit::get_Inst().attach(); //fills and images straight to the panel
+#if PICO_NO_HARDWARE
+    // No alarm interrupts on the host, the tick is read from the clock
+    lv_tick_set_cb(tick_CB);
+#else
+    add_repeating_timer_ms(-WV_RP2040_LCD_LVGL_TICK_MS, tick_Alarm, this, &tickTimer);
+#endif
+
+    display = lv_display_create(WV_RP2040_LCD_WIDTH, WV_RP2040_LCD_HEIGHT);
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(display, drawBufs[0], drawBufs[1], sizeof(drawBufs[0]), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(display, flush_CB);
+    lv_display_add_event_cb(display, invalidate_CB, LV_EVENT_INVALIDATE_AREA, this);
+}
+
+WV_RP2040::WV_RP2040_LCD_LVGL & WV_RP2040::WV_RP2040_LCD_LVGL::get_Inst() {
+    static WV_RP2040_LCD_LVGL __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_LVGL::flush_CB(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_LVGL);
+    WV_RP2040_LCD_DMA &dma = WV_RP2040_LCD_DMA::get_Inst();
+    WV_RP2040_LCD_DrawUnit &unit = WV_RP2040_LCD_DrawUnit::get_Inst();
+    uint32_t w = lv_area_get_width(area);
+    bool is565 = WV_RP2040_LCD::get_Inst().get_ColorMode() == COLOR_RGB565;
+
+    // Rows the draw unit already put on the panel are left out, the rest goes in runs
+    unit.prepare_Flush(area);
+    int32_t y1 = area->y1;
+    while (y1 <= area->y2) {
+        if (!unit.is_RowFlushed(y1)) {
+            y1++;
+            continue;
+        }
+        int32_t y2 = y1;
+        while (y2 < area->y2 && unit.is_RowFlushed(y2 + 1)) y2++;
+
+        const uint16_t *px = (const uint16_t *)px_map + (y1 - area->y1) * w;
+        uint32_t count = w * (y2 - y1 + 1);
+        dma.queue_Window(area->x1, y1, area->x2, y2);
+        if (is565) {
+            // LVGL renders RGB565 in native order, the DMA sends 16 bit frames, no swapping needed
+            dma.queue_Copy(px, count);
+        } else {
+            // RGB444 is converted into the line buffers, LVGL gets the draw buffer back early
+            while (count) {
+                uint32_t n = (count < WV_RP2040_LCD_DMA_BUF_PX) ? count : WV_RP2040_LCD_DMA_BUF_PX;
+                uint16_t *buf = dma.acquire_LineBuf();
+                convert_RGB444(buf, px, n);
+                dma.queue_LineBuf(buf, n);
+                px += n;
+                count -= n;
+            }
+        }
+        y1 = y2 + 1;
+    }
+    unit.end_Band();
+    dma.queue_Notify(flush_Done, disp);
+}
+
+void WV_RP2040::WV_RP2040_LCD_LVGL::flush_Done(void *ctx) {
+    lv_display_flush_ready((lv_display_t *)ctx);
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_LVGL::tick_CB() {
+    return to_ms_since_boot(get_absolute_time());
+}
+
+bool WV_RP2040::WV_RP2040_LCD_LVGL::tick_Alarm(repeating_timer_t *rt) {
+    WV_RP2040_LCD_LVGL *ui = (WV_RP2040_LCD_LVGL *)rt->user_data;
+    lv_tick_inc(WV_RP2040_LCD_LVGL_TICK_MS);
+
+    uint32_t due = ui->dueIn;
+    if (due == LV_NO_TIMER_READY) return true;
+    if (due > WV_RP2040_LCD_LVGL_TICK_MS) {
+        ui->dueIn = due - WV_RP2040_LCD_LVGL_TICK_MS;
+        return true;
+    }
+    ui->dueIn = LV_NO_TIMER_READY;
+    ui->isDue = true;
+    __sev();
+    return true;
+}
+
+void WV_RP2040::WV_RP2040_LCD_LVGL::invalidate_CB(lv_event_t *e) {
+    // The handler reports the redraws its own timers cause in the time it returns
+    WV_RP2040_LCD_LVGL *ui = (WV_RP2040_LCD_LVGL *)lv_event_get_user_data(e);
+    if (!ui->isHandling) ui->isDue = true;
+}
+
+lv_display_t * WV_RP2040::WV_RP2040_LCD_LVGL::get_Display() const {
+    return display;
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_LVGL::handle_Timers() {
+    uint32_t idle = lv_timer_handler();
+    return (idle > WV_RP2040_LCD_LVGL_MAX_IDLE_MS) ? WV_RP2040_LCD_LVGL_MAX_IDLE_MS : idle;
+}
+
+void WV_RP2040::WV_RP2040_LCD_LVGL::run() {
+#if PICO_NO_HARDWARE
+    uint32_t due = dueIn;
+    if (!isDue && due != LV_NO_TIMER_READY) sleep_ms(due);
+#else
+    // Every tick wakes the core for a moment, it goes back to sleep until the handler is due
+    while (!isDue) __wfe();
+#endif
+    // A countdown left from before an early wake must not fire into the next one
+    dueIn = LV_NO_TIMER_READY;
+    isDue = false;
+
+    isHandling = true;
+    uint32_t next = lv_timer_handler();
+    isHandling = false;
+
+    if (next == 0) isDue = true;
+    else dueIn = next;
+}
+
+void WV_RP2040::WV_RP2040_LCD_LVGL::request_Run() {
+    isDue = true;
+#if !PICO_NO_HARDWARE
+    __sev();
+#endif
+}
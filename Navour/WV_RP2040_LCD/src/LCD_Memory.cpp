@@ -0,0 +1,399 @@
+#include <stdio.h>
+#include <string.h>
+#include "LCD_Memory.h"
+
+/*! \def WV RP2040 LCD Memory Class Bytes
+*  \brief Value
+*  \details Bytes of all the class blocks together.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_CLASS_BYTES (WV_RP2040_LCD_MEM_BLOCKS_16 * 16 + WV_RP2040_LCD_MEM_BLOCKS_32 * 32 + \
+    WV_RP2040_LCD_MEM_BLOCKS_64 * 64 + WV_RP2040_LCD_MEM_BLOCKS_128 * 128 + WV_RP2040_LCD_MEM_BLOCKS_256 * 256)
+
+/*! \def WV RP2040 LCD Memory Align [8]
+*  \brief Value
+*  \details Alignment of every pointer handed out, as log2.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_ALIGN_LOG2 3 // 8 bytes
+
+/*! \def WV RP2040 LCD Memory Free Flag [1]
+*  \brief Value
+*  \details Bit of the size of an arena block set while it is free.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_FREE 1u // Free block flag
+
+static_assert(WV_RP2040_LCD_MEM_ARENA_SIZE % (1 << WV_RP2040_LCD_MEM_ALIGN_LOG2) == 0, "The arena must be a multiple of the alignment");
+
+static const uint16_t classBlocks[WV_RP2040_LCD_MEM_CLASSES] = {
+    WV_RP2040_LCD_MEM_BLOCKS_16, WV_RP2040_LCD_MEM_BLOCKS_32, WV_RP2040_LCD_MEM_BLOCKS_64,
+    WV_RP2040_LCD_MEM_BLOCKS_128, WV_RP2040_LCD_MEM_BLOCKS_256
+};
+
+alignas(8) static uint8_t classMem[WV_RP2040_LCD_MEM_CLASS_BYTES];
+alignas(8) static uint8_t arenaMem[WV_RP2040_LCD_MEM_ARENA_SIZE];
+
+/*! \brief Round Up
+*  \ingroup WV_RP2040_LCD_Memory
+*  \category Local Function
+*
+*  Rounds a size up to the alignment.
+*/
+static inline uint32_t round_Up(size_t size) {
+    const uint32_t mask = (1u << WV_RP2040_LCD_MEM_ALIGN_LOG2) - 1;
+    return (uint32_t)((size + mask) & ~(size_t)mask);
+}
+
+/*! \brief Map Size
+*  \ingroup WV_RP2040_LCD_Memory
+*  \category Local Function
+*
+*  The free list of a size. Below 64 bytes the lists are linear in steps of 8 bytes,
+*  above every power of two is split into 1 << SL_LOG2 lists.
+*/
+static inline void map_Size(uint32_t size, uint32_t &fl, uint32_t &sl) {
+    const uint32_t small = 1u << (WV_RP2040_LCD_MEM_SL_LOG2 + WV_RP2040_LCD_MEM_ALIGN_LOG2);
+    if (size < small) {
+        fl = 0;
+        sl = size >> WV_RP2040_LCD_MEM_ALIGN_LOG2;
+        return;
+    }
+    uint32_t msb = 31 - __builtin_clz(size);
+    fl = msb - (WV_RP2040_LCD_MEM_SL_LOG2 + WV_RP2040_LCD_MEM_ALIGN_LOG2) + 1;
+    sl = (size >> (msb - WV_RP2040_LCD_MEM_SL_LOG2)) ^ (1u << WV_RP2040_LCD_MEM_SL_LOG2);
+}
+
+WV_RP2040::WV_RP2040_LCD_Memory::WV_RP2040_LCD_Memory() {
+    lock = spin_lock_init(spin_lock_claim_unused(true));
+    reset();
+}
+
+WV_RP2040::WV_RP2040_LCD_Memory & WV_RP2040::WV_RP2040_LCD_Memory::get_Inst() {
+    static WV_RP2040_LCD_Memory __instance;
+    return __instance;
+}
+
+/*! \def WV RP2040 LCD Memory Header
+*  \brief Value
+*  \details Bytes in front of the payload of an arena block, the free links overlap the payload.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_HEADER offsetof(WV_RP2040_LCD_MEM_BLOCK, nextFree)
+
+/*! \def WV RP2040 LCD Memory Payload
+*  \brief Macro
+*  \details The payload of an arena block.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_PAYLOAD(b) ((uint8_t *)(b) + WV_RP2040_LCD_MEM_HEADER)
+
+/*! \def WV RP2040 LCD Memory Block Of
+*  \brief Macro
+*  \details The arena block of a payload.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_OF(p) ((WV_RP2040_LCD_MEM_BLOCK *)((uint8_t *)(p) - WV_RP2040_LCD_MEM_HEADER))
+
+/*! \def WV RP2040 LCD Memory Size
+*  \brief Macro
+*  \details The payload bytes of an arena block, without the free flag.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_SIZE(b) ((b)->size & ~(uint32_t)((1u << WV_RP2040_LCD_MEM_ALIGN_LOG2) - 1))
+
+/*! \def WV RP2040 LCD Memory Next
+*  \brief Macro
+*  \details The arena block following a block in memory.
+*  \ingroup WV_RP2040_LCD_Memory
+*/
+#define WV_RP2040_LCD_MEM_NEXT(b) ((WV_RP2040_LCD_MEM_BLOCK *)(WV_RP2040_LCD_MEM_PAYLOAD(b) + WV_RP2040_LCD_MEM_SIZE(b)))
+
+void WV_RP2040::WV_RP2040_LCD_Memory::reset() {
+    uint32_t irq = spin_lock_blocking(lock);
+
+    //every class is one free list through the first word of its blocks
+    uint8_t *base = classMem;
+    for (uint8_t c = 0; c < WV_RP2040_LCD_MEM_CLASSES; c++) {
+        uint16_t size = WV_RP2040_LCD_MEM_MIN_CLASS << c;
+        classBase[c] = base;
+        classFree[c] = NULL;
+        for (int32_t i = classBlocks[c] - 1; i >= 0; i--) {
+            void **block = (void **)(base + i * size);
+            *block = classFree[c];
+            classFree[c] = block;
+        }
+        classStats[c] = { size, classBlocks[c], 0, 0, 0 };
+        base += classBlocks[c] * size;
+    }
+
+    //the arena is one free block, closed by a used sentinel of no size
+    flMap = 0;
+    memset(slMap, 0, sizeof(slMap));
+    memset(heads, 0, sizeof(heads));
+
+    WV_RP2040_LCD_MEM_BLOCK *first = (WV_RP2040_LCD_MEM_BLOCK *)arenaMem;
+    first->prevPhys = NULL;
+    first->size = WV_RP2040_LCD_MEM_ARENA_SIZE - 2 * WV_RP2040_LCD_MEM_HEADER;
+    WV_RP2040_LCD_MEM_BLOCK *sentinel = WV_RP2040_LCD_MEM_NEXT(first);
+    sentinel->prevPhys = first;
+    sentinel->size = 0;
+    insert_Free(first);
+
+    liveBytes = 0;
+    peakBytes = 0;
+    failures = 0;
+
+    spin_unlock(lock, irq);
+}
+
+int8_t WV_RP2040::WV_RP2040_LCD_Memory::get_Class(const void *p) const {
+    const uint8_t *b = (const uint8_t *)p;
+    if (b < classMem || b >= classMem + sizeof(classMem)) return -1;
+
+    int8_t c = WV_RP2040_LCD_MEM_CLASSES - 1;
+    while (b < classBase[c]) c--;
+    return c;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Memory::insert_Free(WV_RP2040_LCD_MEM_BLOCK *b) {
+    uint32_t fl, sl;
+    map_Size(WV_RP2040_LCD_MEM_SIZE(b), fl, sl);
+
+    b->size |= WV_RP2040_LCD_MEM_FREE;
+    b->prevFree = NULL;
+    b->nextFree = heads[fl][sl];
+    if (b->nextFree) b->nextFree->prevFree = b;
+    heads[fl][sl] = b;
+
+    flMap |= 1u << fl;
+    slMap[fl] |= 1u << sl;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Memory::remove_Free(WV_RP2040_LCD_MEM_BLOCK *b) {
+    uint32_t fl, sl;
+    map_Size(WV_RP2040_LCD_MEM_SIZE(b), fl, sl);
+
+    if (b->prevFree) b->prevFree->nextFree = b->nextFree;
+    else heads[fl][sl] = b->nextFree;
+    if (b->nextFree) b->nextFree->prevFree = b->prevFree;
+
+    if (!heads[fl][sl]) {
+        slMap[fl] &= ~(1u << sl);
+        if (!slMap[fl]) flMap &= ~(1u << fl);
+    }
+    b->size &= ~WV_RP2040_LCD_MEM_FREE;
+}
+
+void * WV_RP2040::WV_RP2040_LCD_Memory::arena_Alloc(size_t size) {
+    const uint32_t minSize = sizeof(WV_RP2040_LCD_MEM_BLOCK) - WV_RP2040_LCD_MEM_HEADER;
+    if (size > WV_RP2040_LCD_MEM_ARENA_SIZE) return NULL;
+    uint32_t need = round_Up(size);
+    if (need < minSize) need = minSize;
+
+    //round up to the next list, every block on it or above fits without a search
+    uint32_t search = need;
+    if (search >= (1u << (WV_RP2040_LCD_MEM_SL_LOG2 + WV_RP2040_LCD_MEM_ALIGN_LOG2)))
+        search += (1u << (31 - __builtin_clz(search) - WV_RP2040_LCD_MEM_SL_LOG2)) - 1;
+    uint32_t fl, sl;
+    map_Size(search, fl, sl);
+    if (fl >= WV_RP2040_LCD_MEM_FL_COUNT) return NULL;
+
+    uint32_t slFit = slMap[fl] & (~0u << sl);
+    if (!slFit) {
+        uint32_t flFit = (fl + 1 < 32) ? flMap & (~0u << (fl + 1)) : 0;
+        if (!flFit) return NULL;
+        fl = __builtin_ctz(flFit);
+        slFit = slMap[fl];
+    }
+    sl = __builtin_ctz(slFit);
+
+    WV_RP2040_LCD_MEM_BLOCK *b = heads[fl][sl];
+    remove_Free(b);
+
+    //split the rest off if it can hold a block of its own
+    uint32_t size0 = WV_RP2040_LCD_MEM_SIZE(b);
+    if (size0 - need >= sizeof(WV_RP2040_LCD_MEM_BLOCK)) {
+        b->size = need;
+        WV_RP2040_LCD_MEM_BLOCK *rest = WV_RP2040_LCD_MEM_NEXT(b);
+        rest->prevPhys = b;
+        rest->size = size0 - need - WV_RP2040_LCD_MEM_HEADER;
+        WV_RP2040_LCD_MEM_NEXT(rest)->prevPhys = rest;
+        insert_Free(rest);
+    }
+    return WV_RP2040_LCD_MEM_PAYLOAD(b);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Memory::arena_Free(void *p) {
+    WV_RP2040_LCD_MEM_BLOCK *b = WV_RP2040_LCD_MEM_OF(p);
+
+    //merge with the free neighbours, there are never two free blocks in a row
+    WV_RP2040_LCD_MEM_BLOCK *prev = b->prevPhys;
+    if (prev && (prev->size & WV_RP2040_LCD_MEM_FREE)) {
+        remove_Free(prev);
+        prev->size = WV_RP2040_LCD_MEM_SIZE(prev) + WV_RP2040_LCD_MEM_HEADER + WV_RP2040_LCD_MEM_SIZE(b);
+        b = prev;
+        WV_RP2040_LCD_MEM_NEXT(b)->prevPhys = b;
+    }
+    WV_RP2040_LCD_MEM_BLOCK *next = WV_RP2040_LCD_MEM_NEXT(b);
+    if (next->size & WV_RP2040_LCD_MEM_FREE) {
+        remove_Free(next);
+        b->size = WV_RP2040_LCD_MEM_SIZE(b) + WV_RP2040_LCD_MEM_HEADER + WV_RP2040_LCD_MEM_SIZE(next);
+        WV_RP2040_LCD_MEM_NEXT(b)->prevPhys = b;
+    }
+    insert_Free(b);
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_Memory::get_Usable(const void *p) const {
+    int8_t c = get_Class(p);
+    if (c >= 0) return classStats[c].size;
+    return WV_RP2040_LCD_MEM_SIZE(WV_RP2040_LCD_MEM_OF(p));
+}
+
+void * WV_RP2040::WV_RP2040_LCD_Memory::alloc(size_t size) {
+    if (!size) size = 1;
+
+    uint32_t irq = spin_lock_blocking(lock);
+
+    //smallest class the request fits, a full class overflows to the arena
+    void *p = NULL;
+    uint8_t c = 0;
+    while (c < WV_RP2040_LCD_MEM_CLASSES && (size_t)(WV_RP2040_LCD_MEM_MIN_CLASS << c) < size) c++;
+    if (c < WV_RP2040_LCD_MEM_CLASSES) {
+        if (classFree[c]) {
+            p = classFree[c];
+            classFree[c] = *(void **)p;
+            WV_RP2040_LCD_MEM_CLASS_STATS &s = classStats[c];
+            if (++s.used > s.peak) s.peak = s.used;
+        }
+        else classStats[c].overflows++;
+    }
+    if (!p) p = arena_Alloc(size);
+
+    if (p) {
+        liveBytes += get_Usable(p);
+        if (liveBytes > peakBytes) peakBytes = liveBytes;
+    }
+    else failures++;
+
+    spin_unlock(lock, irq);
+    return p;
+}
+
+void * WV_RP2040::WV_RP2040_LCD_Memory::resize(void *p, size_t size) {
+    if (!p) return alloc(size);
+
+    //the usable size of a handed out block does not change, no lock needed to read it
+    uint32_t usable = get_Usable(p);
+    if (size <= usable) return p;
+
+    void *q = alloc(size);
+    if (!q) return NULL;
+    memcpy(q, p, usable);
+    release(p);
+    return q;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Memory::release(void *p) {
+    if (!p) return;
+
+    uint32_t irq = spin_lock_blocking(lock);
+
+    liveBytes -= get_Usable(p);
+    int8_t c = get_Class(p);
+    if (c >= 0) {
+        *(void **)p = classFree[c];
+        classFree[c] = p;
+        classStats[c].used--;
+    }
+    else arena_Free(p);
+
+    spin_unlock(lock, irq);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Memory::get_Stats(WV_RP2040_LCD_MEM_STATS &stats) const {
+    memset(&stats, 0, sizeof(stats));
+    stats.totalBytes = sizeof(classMem) + sizeof(arenaMem);
+
+    uint32_t irq = spin_lock_blocking(lock);
+
+    stats.liveBytes = liveBytes;
+    stats.peakBytes = peakBytes;
+    stats.failures = failures;
+    memcpy(stats.classes, classStats, sizeof(classStats));
+
+    const WV_RP2040_LCD_MEM_BLOCK *b = (const WV_RP2040_LCD_MEM_BLOCK *)arenaMem;
+    for (; WV_RP2040_LCD_MEM_SIZE(b); b = WV_RP2040_LCD_MEM_NEXT(b)) {
+        if (b->size & WV_RP2040_LCD_MEM_FREE) {
+            uint32_t size = WV_RP2040_LCD_MEM_SIZE(b);
+            stats.arenaFree += size;
+            if (size > stats.arenaBiggest) stats.arenaBiggest = size;
+            stats.arenaFreeBlocks++;
+        }
+        else stats.arenaUsedBlocks++;
+    }
+
+    spin_unlock(lock, irq);
+
+    //share of the free arena a single request can not reach
+    if (stats.arenaFree)
+        stats.fragmentation = (uint8_t)(100 - (uint64_t)stats.arenaBiggest * 100 / stats.arenaFree);
+}
+
+bool WV_RP2040::WV_RP2040_LCD_Memory::check() const {
+    bool isValid = true;
+    uint32_t irq = spin_lock_blocking(lock);
+
+    //the classes, every block is either handed out or on the free list
+    for (uint8_t c = 0; c < WV_RP2040_LCD_MEM_CLASSES && isValid; c++) {
+        uint32_t freeBlocks = 0;
+        for (void *p = classFree[c]; p && freeBlocks <= classBlocks[c]; p = *(void **)p) {
+            if (get_Class(p) != c) isValid = false;
+            freeBlocks++;
+        }
+        if (freeBlocks + classStats[c].used != classBlocks[c]) isValid = false;
+    }
+
+    //the arena, the blocks chain up to the sentinel and the free ones are all listed
+    const uint8_t *end = arenaMem + sizeof(arenaMem) - WV_RP2040_LCD_MEM_HEADER;
+    const WV_RP2040_LCD_MEM_BLOCK *prev = NULL;
+    const WV_RP2040_LCD_MEM_BLOCK *b = (const WV_RP2040_LCD_MEM_BLOCK *)arenaMem;
+    uint32_t freeBlocks = 0;
+    while (isValid && (const uint8_t *)b < end) {
+        if (b->prevPhys != prev || !WV_RP2040_LCD_MEM_SIZE(b)) isValid = false;
+        if (b->size & WV_RP2040_LCD_MEM_FREE) {
+            if (prev && (prev->size & WV_RP2040_LCD_MEM_FREE)) isValid = false;
+            freeBlocks++;
+        }
+        prev = b;
+        b = WV_RP2040_LCD_MEM_NEXT(b);
+    }
+    if ((const uint8_t *)b != end || b->prevPhys != prev || b->size) isValid = false;
+
+    for (uint32_t fl = 0; fl < WV_RP2040_LCD_MEM_FL_COUNT && isValid; fl++) {
+        for (uint32_t sl = 0; sl < (1u << WV_RP2040_LCD_MEM_SL_LOG2); sl++) {
+            if (!heads[fl][sl] != !(slMap[fl] & (1u << sl))) isValid = false;
+            for (const WV_RP2040_LCD_MEM_BLOCK *f = heads[fl][sl]; f && isValid; f = f->nextFree) {
+                if (!(f->size & WV_RP2040_LCD_MEM_FREE) || !freeBlocks) isValid = false;
+                else freeBlocks--;
+            }
+        }
+    }
+    if (freeBlocks) isValid = false;
+
+    spin_unlock(lock, irq);
+    return isValid;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Memory::print() const {
+    WV_RP2040_LCD_MEM_STATS s;
+    get_Stats(s);
+    printf("LVGL heap %lu of %lu bytes live, peak %lu, %lu failed\n",
+        (unsigned long)s.liveBytes, (unsigned long)s.totalBytes, (unsigned long)s.peakBytes, (unsigned long)s.failures);
+    printf("  %-8s free %lu, biggest %lu, blocks %u free %u used, fragmentation %u%%\n", "arena",
+        (unsigned long)s.arenaFree, (unsigned long)s.arenaBiggest, s.arenaFreeBlocks, s.arenaUsedBlocks, s.fragmentation);
+    for (uint8_t c = 0; c < WV_RP2040_LCD_MEM_CLASSES; c++) {
+        const WV_RP2040_LCD_MEM_CLASS_STATS &k = s.classes[c];
+        printf("  %-8u used %u of %u, peak %u, overflows %lu\n", k.size, k.used, k.blocks, k.peak, (unsigned long)k.overflows);
+    }
+}
@@ -0,0 +1,316 @@
+#include <string.h>
+#include "WV_RP2040_LCD.h"
+#include "LCD_OS.h"
+
+#if PICO_NO_HARDWARE
+#include <mutex>
+#include <thread>
+
+// Real threads on the host, the spin lock and the events are modelled with a mutex and yields
+static std::mutex hostLock;
+static thread_local uint8_t hostContext = WV_RP2040::WV_RP2040_LCD_OS::CONTEXT_MAIN;
+#else
+#include "pico/multicore.h"
+#endif
+
+/*! \def WV RP2040 LCD OS Start Frame [11]
+*  \brief Value
+*  \details Words of the first frame of the core0 thread, r8 - r11, r4 - r7, pc and 8 byte alignment.
+*  \ingroup WV_RP2040_LCD_OS
+*/
+#define WV_RP2040_LCD_OS_START_FRAME 11 // Words popped by the first switch
+
+/*! \brief Enter
+*  \ingroup WV_RP2040_LCD_OS
+*  \category Local Function
+*
+*  Takes the spin lock of the port.
+*/
+static inline uint32_t enter(spin_lock_t *lock) {
+#if PICO_NO_HARDWARE
+    (void)lock;
+    hostLock.lock();
+    return 0;
+#else
+    return spin_lock_blocking(lock);
+#endif
+}
+
+/*! \brief Leave
+*  \ingroup WV_RP2040_LCD_OS
+*  \category Local Function
+*
+*  Releases the spin lock of the port.
+*/
+static inline void leave(spin_lock_t *lock, uint32_t irq) {
+#if PICO_NO_HARDWARE
+    (void)lock;
+    (void)irq;
+    hostLock.unlock();
+#else
+    spin_unlock(lock, irq);
+#endif
+}
+
+/*! \brief Wake
+*  \ingroup WV_RP2040_LCD_OS
+*  \category Local Function
+*
+*  Wakes a core sleeping in WFE.
+*/
+static inline void wake() {
+#if !PICO_NO_HARDWARE
+    __sev();
+#endif
+}
+
+/*! \brief In Interrupt
+*  \ingroup WV_RP2040_LCD_OS
+*  \category Local Function
+*
+*  True while the core runs an exception handler.
+*/
+static inline bool in_Interrupt() {
+#if PICO_NO_HARDWARE
+    return false;
+#else
+    return __get_current_exception() != 0;
+#endif
+}
+
+#if !PICO_NO_HARDWARE
+/*! \brief Switch Context
+*  \ingroup WV_RP2040_LCD_OS
+*  \category Local Function
+*
+*  Saves the callee saved registers on the current stack, stores its pointer to save,
+*  then continues on the stack at load. Both core0 contexts only ever switch here, so
+*  the caller saved registers are already spilled by the compiler.
+*/
+static void __attribute__((naked, noinline)) switch_Context(uint32_t **save, uint32_t *load) {
+    __asm volatile(
+        "push {r4-r7, lr}   \n"
+        "mov r4, r8         \n"
+        "mov r5, r9         \n"
+        "mov r6, r10        \n"
+        "mov r7, r11        \n"
+        "push {r4-r7}       \n"
+        "mov r2, sp         \n"
+        "str r2, [r0]       \n"
+        "mov sp, r1         \n"
+        "pop {r4-r7}        \n"
+        "mov r8, r4         \n"
+        "mov r9, r5         \n"
+        "mov r10, r6        \n"
+        "mov r11, r7        \n"
+        "pop {r4-r7, pc}    \n"
+    );
+}
+#endif
+
+WV_RP2040::WV_RP2040_LCD_OS::WV_RP2040_LCD_OS() :
+    threads(), threadCount(0), isParallel(true), renderOwner(CONTEXT_NONE), renderUs(), renderStart(), isWorking(),
+    isInCore0(false), isCore0Runnable(false), core0Wait(NULL), mainSp(NULL), core0Sp(NULL) {
+#if PICO_NO_HARDWARE
+    lock = NULL;
+#else
+    lock = spin_lock_init(spin_lock_claim_unused(true));
+#endif
+}
+
+WV_RP2040::WV_RP2040_LCD_OS & WV_RP2040::WV_RP2040_LCD_OS::get_Inst() {
+    static WV_RP2040_LCD_OS __instance;
+    return __instance;
+}
+
+WV_RP2040::WV_RP2040_LCD_OS::WV_RP2040_LCD_OS_CONTEXT WV_RP2040::WV_RP2040_LCD_OS::get_Context() const {
+#if PICO_NO_HARDWARE
+    return (WV_RP2040_LCD_OS_CONTEXT)hostContext;
+#else
+    if (get_core_num()) return CONTEXT_CORE1;
+    return isInCore0 ? CONTEXT_CORE0 : CONTEXT_MAIN;
+#endif
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::core1_Entry() {
+#if !PICO_NO_HARDWARE
+    lv_thread_t *t = get_Inst().threads[0];
+    t->callback(t->user_data);
+
+    // The thread was told to exit, core1 stays parked
+    while (true) __wfe();
+#endif
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::core0_Entry() {
+#if !PICO_NO_HARDWARE
+    WV_RP2040_LCD_OS &os = get_Inst();
+    lv_thread_t *t = os.threads[1];
+    t->callback(t->user_data);
+
+    // Never runnable again, the main loop keeps core0 from now on
+    os.isCore0Runnable = false;
+    os.core0Wait = NULL;
+    while (true) switch_Context(&os.core0Sp, os.mainSp);
+#endif
+}
+
+bool WV_RP2040::WV_RP2040_LCD_OS::start_Thread(lv_thread_t *thread, size_t stackSize) {
+    if (threadCount >= WV_RP2040_LCD_OS_THREADS || stackSize > sizeof(stacks[0])) return false;
+
+    // The first thread goes to core1, unless the display list runs there
+    if (!threadCount && !WV_RP2040_LCD::claim_Core1(WV_RP2040_LCD::CORE1_LVGL)) return false;
+    uint8_t i = threadCount++;
+    threads[i] = thread;
+    thread->context = i ? CONTEXT_CORE0 : CONTEXT_CORE1;
+
+#if PICO_NO_HARDWARE
+    std::thread([thread]() {
+        hostContext = thread->context;
+        thread->callback(thread->user_data);
+    }).detach();
+#else
+    if (!i) {
+        multicore_launch_core1_with_stack(core1_Entry, stacks[0], sizeof(stacks[0]));
+        return true;
+    }
+
+    // The first switch to the core0 thread pops this frame and returns into core0_Entry
+    uint32_t *sp = &stacks[1][WV_RP2040_LCD_OS_STACK_WORDS - WV_RP2040_LCD_OS_START_FRAME];
+    memset(sp, 0, WV_RP2040_LCD_OS_START_FRAME * sizeof(uint32_t));
+    sp[8] = (uint32_t)(uintptr_t)core0_Entry;
+    core0Sp = sp;
+    isCore0Runnable = true;
+#endif
+    return true;
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::run_Core0() {
+#if !PICO_NO_HARDWARE
+    isInCore0 = true;
+    switch_Context(&mainSp, core0Sp);
+    isInCore0 = false;
+#endif
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::yield_Core0() {
+#if PICO_NO_HARDWARE
+    std::this_thread::yield();
+#else
+    if (get_core_num()) {
+        __wfe();
+        return;
+    }
+    if (isInCore0) {
+        // Back to the main loop, it switches here again once there is something to do
+        switch_Context(&core0Sp, mainSp);
+        return;
+    }
+
+    lv_thread_sync_t *wait = core0Wait;
+    if (threadCount > 1 && (isCore0Runnable || (wait && wait->is_signaled))) run_Core0();
+    else __wfe();
+#endif
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::take_Render(uint8_t ctx) {
+    if (ctx != CONTEXT_CORE1 && ctx != CONTEXT_CORE0) return;
+
+    while (true) {
+        uint32_t irq = enter(lock);
+        bool isFree = isParallel || renderOwner == CONTEXT_NONE || renderOwner == ctx;
+        if (isFree && !isParallel) renderOwner = ctx;
+        leave(lock, irq);
+        if (isFree) break;
+        yield_Core0();
+    }
+
+    uint8_t i = ctx - CONTEXT_CORE1;
+    renderStart[i] = time_us_32();
+    isWorking[i] = true;
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::give_Render(uint8_t ctx) {
+    if (ctx != CONTEXT_CORE1 && ctx != CONTEXT_CORE0) return;
+
+    uint8_t i = ctx - CONTEXT_CORE1;
+    if (isWorking[i]) renderUs[i] += time_us_32() - renderStart[i];
+    isWorking[i] = false;
+
+    uint32_t irq = enter(lock);
+    if (renderOwner == ctx) renderOwner = CONTEXT_NONE;
+    leave(lock, irq);
+    wake();
+}
+
+bool WV_RP2040::WV_RP2040_LCD_OS::lock_Mutex(lv_mutex_t *mutex, bool isBlocking) {
+    uint8_t ctx = get_Context();
+
+    // An interrupt counts as the context it interrupted, it must not nest into a lock held there
+    bool isNestable = !in_Interrupt();
+    while (true) {
+        uint32_t irq = enter(lock);
+        bool isFree = mutex->owner == CONTEXT_NONE || (mutex->owner == ctx && isNestable);
+        if (isFree) {
+            mutex->owner = ctx;
+            mutex->depth++;
+        }
+        leave(lock, irq);
+        if (isFree) return true;
+        if (!isBlocking) return false;
+        yield_Core0();
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::unlock_Mutex(lv_mutex_t *mutex) {
+    uint32_t irq = enter(lock);
+    if (mutex->depth && !--mutex->depth) mutex->owner = CONTEXT_NONE;
+    leave(lock, irq);
+    wake();
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::wait_Sync(lv_thread_sync_t *sync) {
+    uint8_t ctx = get_Context();
+    give_Render(ctx);
+
+    while (true) {
+        uint32_t irq = enter(lock);
+        bool isSet = sync->is_signaled;
+        sync->is_signaled = 0;
+        leave(lock, irq);
+        if (isSet) break;
+
+        // The main loop switches back once the event is set
+        if (ctx == CONTEXT_CORE0) {
+            core0Wait = sync;
+            isCore0Runnable = false;
+        }
+        yield_Core0();
+    }
+    if (ctx == CONTEXT_CORE0) {
+        core0Wait = NULL;
+        isCore0Runnable = true;
+    }
+
+    take_Render(ctx);
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::signal_Sync(lv_thread_sync_t *sync) {
+    uint32_t irq = enter(lock);
+    sync->is_signaled = 1;
+    leave(lock, irq);
+    wake();
+}
+
+void WV_RP2040::WV_RP2040_LCD_OS::set_Parallel(bool setParallel) {
+    isParallel = setParallel;
+    wake();
+}
+
+uint8_t WV_RP2040::WV_RP2040_LCD_OS::get_ThreadCount() const {
+    return threadCount;
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_OS::get_RenderUs(uint8_t index) const {
+    return (index < WV_RP2040_LCD_OS_THREADS) ? renderUs[index] : 0;
+}
@@ -0,0 +1,106 @@
+#include "hardware/dma.h"
+#include "GPIO_Util.h"
+#include "WV_RP2040_LCD.h"
+#include "LCD_PIO.h"
+#include "LCD_PIO.pio.h"
+
+WV_RP2040::WV_RP2040_LCD_PIO::WV_RP2040_LCD_PIO() : pio(pio0), sm(-1), offset(0), pixelBits(16), isReading(false) {
+}
+
+WV_RP2040::WV_RP2040_LCD_PIO & WV_RP2040::WV_RP2040_LCD_PIO::get_Inst() {
+    static WV_RP2040_LCD_PIO __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::init() {
+    offset = pio_add_program(pio, &wv_rp2040_lcd_program);
+    sm = pio_claim_unused_sm(pio, true);
+    wv_rp2040_lcd_program_init(pio, sm, offset, WV_RP2040_LCD_DIN_PIN, WV_RP2040_LCD_CLK_PIN,
+        WV_RP2040_LCD_DC_PIN, WV_RP2040_LCD_PIO_CLKDIV);
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::deinit() {
+    if (sm < 0) return;
+    pio_sm_set_enabled(pio, sm, false);
+    pio_sm_unclaim(pio, sm);
+    pio_remove_program(pio, &wv_rp2040_lcd_program, offset);
+    sm = -1;
+
+    // Hand the pins back to the CPU, the next transport routes them to its own peripheral
+    gpio_set_function(WV_RP2040_LCD_DIN_PIN, GPIO_FUNC_SIO);
+    gpio_set_function(WV_RP2040_LCD_CLK_PIN, GPIO_FUNC_SIO);
+    gpio_set_function(WV_RP2040_LCD_DC_PIN, GPIO_FUNC_SIO);
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::put_Header(bool isData, uint8_t unitBits, uint32_t units, bool isNibbleSkipped) {
+    uint32_t header = ((uint32_t)isData << 31) | ((uint32_t)(unitBits - 1) << 26) | ((units - 1) << 10) |
+        ((uint32_t)isNibbleSkipped << 9);
+    pio_sm_put_blocking(pio, sm, header);
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::put_Nibble() {
+    put_Header(true, 4, 1);
+    pio_sm_put_blocking(pio, sm, 0);
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::select(bool setSelected) {
+    // An odd run of 12 bit pixels still needs its last nibble before CS goes up
+    if (!setSelected && pad_Byte()) wait_Bus();
+    digital_write(WV_RP2040_LCD_CS_PIN, (setSelected) ? DIGITAL_LOW : DIGITAL_HIGH);
+
+    // The controller lets go of DIN with the chip select, the state machine can drive it again
+    if (!setSelected && isReading) {
+        pio_gpio_init(pio, WV_RP2040_LCD_CLK_PIN);
+        pio_gpio_init(pio, WV_RP2040_LCD_DIN_PIN);
+        isReading = false;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::write_Bytes(bool isData, const uint8_t *data, size_t len) {
+    // The FIFO keeps the order, no need to wait for the previous burst to drain
+    pad_Byte();
+    while (len) {
+        size_t n = (len > 65536) ? 65536 : len;
+        put_Header(isData, 8, n);
+        for (size_t i = 0; i < n; i++) pio_sm_put_blocking(pio, sm, (uint32_t)data[i] << 24);
+        data += n;
+        len -= n;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::read_Bytes(uint8_t *data, size_t len, uint8_t dummyBits) {
+    if (!isReading) {
+        wait_Bus();
+        isReading = true;
+    }
+    clock_In(data, len, dummyBits);
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::set_PixelBits(uint8_t bits) {
+    pixelBits = (bits == 12) ? 12 : 16;
+}
+
+bool WV_RP2040::WV_RP2040_LCD_PIO::start_Pixels(int dmaChannel, const uint16_t *src, uint32_t count, bool increment) {
+    // RGB444 sits in the low 12 bits of the halfword, the program drops the top nibble
+    put_Header(true, pixelBits, count, pixelBits == 12);
+    count_Pixels(pixelBits, count);
+
+    dma_channel_config cfg = dma_channel_get_default_config(dmaChannel);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_dreq(&cfg, pio_get_dreq(pio, sm, true));
+    channel_config_set_read_increment(&cfg, increment);
+    channel_config_set_write_increment(&cfg, false);
+    dma_channel_configure(dmaChannel, &cfg, &pio->txf[sm], src, count, true);
+    return false;
+}
+
+void WV_RP2040::WV_RP2040_LCD_PIO::wait_Bus() {
+    // Idle once the FIFO is empty and the program stalls on the pull of the next header
+    uint32_t stallMask = 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
+    pio->fdebug = stallMask;
+    while (!pio_sm_is_tx_fifo_empty(pio, sm) || !(pio->fdebug & stallMask)) tight_loop_contents();
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_PIO::get_MaxPixels() const {
+    return 65536;
+}
@@ -0,0 +1,138 @@
+#include "LCD_OS.h"
+#include "LCD_Memory.h"
+
+#if LV_USE_OS == LV_OS_CUSTOM
+
+//LVGL OS hooks, the draw threads and the locks of LVGL land here
+
+extern "C" {
+
+lv_result_t lv_thread_init(lv_thread_t *thread, const char *const name, lv_thread_prio_t prio,
+    void (*callback)(void *), size_t stack_size, void *user_data) {
+    (void)name;
+    (void)prio; //every thread has a core to itself, or waits for the main loop
+    thread->callback = callback;
+    thread->user_data = user_data;
+    thread->context = WV_RP2040::WV_RP2040_LCD_OS::CONTEXT_NONE;
+    return WV_RP2040::WV_RP2040_LCD_OS::get_Inst().start_Thread(thread, stack_size) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+lv_result_t lv_thread_delete(lv_thread_t *thread) {
+    //threads exit by returning, the core they ran on stays parked
+    (void)thread;
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_mutex_init(lv_mutex_t *mutex) {
+    mutex->owner = WV_RP2040::WV_RP2040_LCD_OS::CONTEXT_NONE;
+    mutex->depth = 0;
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_mutex_lock(lv_mutex_t *mutex) {
+    WV_RP2040::WV_RP2040_LCD_OS::get_Inst().lock_Mutex(mutex, true);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_mutex_lock_isr(lv_mutex_t *mutex) {
+    return WV_RP2040::WV_RP2040_LCD_OS::get_Inst().lock_Mutex(mutex, false) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+lv_result_t lv_mutex_unlock(lv_mutex_t *mutex) {
+    WV_RP2040::WV_RP2040_LCD_OS::get_Inst().unlock_Mutex(mutex);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_mutex_delete(lv_mutex_t *mutex) {
+    (void)mutex;
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_init(lv_thread_sync_t *sync) {
+    sync->is_signaled = 0;
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_wait(lv_thread_sync_t *sync) {
+    WV_RP2040::WV_RP2040_LCD_OS::get_Inst().wait_Sync(sync);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_signal(lv_thread_sync_t *sync) {
+    WV_RP2040::WV_RP2040_LCD_OS::get_Inst().signal_Sync(sync);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_signal_isr(lv_thread_sync_t *sync) {
+    WV_RP2040::WV_RP2040_LCD_OS::get_Inst().signal_Sync(sync);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_delete(lv_thread_sync_t *sync) {
+    (void)sync;
+    return LV_RESULT_OK;
+}
+
+}
+
+#endif
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+//LVGL memory hooks, lv_malloc() and friends land here
+
+void lv_mem_init(void) {
+    WV_RP2040::WV_RP2040_LCD_Memory::get_Inst().reset();
+}
+
+void lv_mem_deinit(void) {
+    WV_RP2040::WV_RP2040_LCD_Memory::get_Inst().reset();
+}
+
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes) {
+    //the classes and the arena are fixed in size
+    (void)mem;
+    (void)bytes;
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    (void)pool;
+}
+
+void * lv_malloc_core(size_t size) {
+    return WV_RP2040::WV_RP2040_LCD_Memory::get_Inst().alloc(size);
+}
+
+void * lv_realloc_core(void *p, size_t new_size) {
+    return WV_RP2040::WV_RP2040_LCD_Memory::get_Inst().resize(p, new_size);
+}
+
+void lv_free_core(void *p) {
+    WV_RP2040::WV_RP2040_LCD_Memory::get_Inst().release(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p) {
+    WV_RP2040::WV_RP2040_LCD_MEM_STATS s;
+    WV_RP2040::WV_RP2040_LCD_Memory::get_Inst().get_Stats(s);
+
+    uint32_t classFree = 0, classUsed = 0;
+    for (uint8_t c = 0; c < WV_RP2040_LCD_MEM_CLASSES; c++) {
+        classFree += s.classes[c].blocks - s.classes[c].used;
+        classUsed += s.classes[c].used;
+    }
+    mon_p->total_size = s.totalBytes;
+    mon_p->free_size = s.totalBytes - s.liveBytes;
+    mon_p->free_biggest_size = s.arenaBiggest;
+    mon_p->free_cnt = s.arenaFreeBlocks + classFree;
+    mon_p->used_cnt = s.arenaUsedBlocks + classUsed;
+    mon_p->max_used = s.peakBytes;
+    mon_p->used_pct = (uint8_t)((uint64_t)s.liveBytes * 100 / s.totalBytes);
+    mon_p->frag_pct = s.fragmentation;
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return WV_RP2040::WV_RP2040_LCD_Memory::get_Inst().check() ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+#endif
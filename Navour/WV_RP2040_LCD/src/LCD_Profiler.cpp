@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <string.h>
+#include "LCD_Profiler.h"
+
+#if WV_RP2040_LCD_PROFILE
+
+static const char *primNames[WV_RP2040::PROF_PRIM_COUNT] = {
+    "none", "command", "window", "pixels", "rect", "line", "round", "polygon", "text", "present", "lvgl", "image", "blend"
+};
+
+WV_RP2040::WV_RP2040_LCD_Profiler::WV_RP2040_LCD_Profiler() {
+    reset();
+}
+
+WV_RP2040::WV_RP2040_LCD_Profiler & WV_RP2040::WV_RP2040_LCD_Profiler::get_Inst() {
+    static WV_RP2040_LCD_Profiler __instance;
+    return __instance;
+}
+
+WV_RP2040::WV_RP2040_LCD_PROF_PRIM WV_RP2040::WV_RP2040_LCD_Profiler::enter(WV_RP2040_LCD_PROF_PRIM prim) {
+    WV_RP2040_LCD_PROF_PRIM prev = current;
+    if (current == PROF_NONE) {
+        current = prim;
+        counters[prim].calls++;
+    }
+    return prev;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::leave(WV_RP2040_LCD_PROF_PRIM prev) {
+    current = prev;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::add_Transaction(uint32_t bytes) {
+    counters[current].bytes += bytes;
+    counters[current].transactions++;
+    frame.bytes += bytes;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::add_Blocked(uint64_t us) {
+    counters[current].blockedUs += us;
+    frame.blockedUs += us;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::set_Bus(bool isSelected) {
+    uint64_t now = time_us_64();
+    if (isSelected) busStartUs = now;
+    else busUs = busUs + (now - busStartUs);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::begin_Frame() {
+    memset(&frame, 0, sizeof(frame));
+    busUs = 0;
+    frameStartUs = time_us_64();
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::end_Frame() {
+    if (!frameStartUs) return;
+
+    frame.frameUs = time_us_64() - frameStartUs;
+    frame.busUs = busUs;
+    frames[frameCount % WV_RP2040_LCD_PROF_FRAMES] = frame;
+    frameCount++;
+    frameStartUs = 0;
+}
+
+const WV_RP2040::WV_RP2040_LCD_PROF_COUNTERS & WV_RP2040::WV_RP2040_LCD_Profiler::get_Counters(WV_RP2040_LCD_PROF_PRIM prim) const {
+    return counters[(prim < PROF_PRIM_COUNT) ? prim : PROF_NONE];
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::get_Summary(WV_RP2040_LCD_PROF_SUMMARY &summary) const {
+    memset(&summary, 0, sizeof(summary));
+    summary.frames = (frameCount < WV_RP2040_LCD_PROF_FRAMES) ? frameCount : WV_RP2040_LCD_PROF_FRAMES;
+    if (!summary.frames) return;
+
+    uint64_t frameUs = 0, busSum = 0, bytes = 0, blockedUs = 0;
+    for (uint32_t i = 0; i < summary.frames; i++) {
+        frameUs += frames[i].frameUs;
+        busSum += frames[i].busUs;
+        bytes += frames[i].bytes;
+        blockedUs += frames[i].blockedUs;
+    }
+
+    summary.fps = (frameUs) ? (float)summary.frames * 1000000.0f / (float)frameUs : 0.0f;
+    summary.busUtilization = (frameUs) ? (float)busSum / (float)frameUs : 0.0f;
+    summary.bytesPerFrame = (uint32_t)(bytes / summary.frames);
+    summary.blockedUsPerFrame = (uint32_t)(blockedUs / summary.frames);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::print() const {
+    WV_RP2040_LCD_PROF_SUMMARY s;
+    get_Summary(s);
+    printf("LCD %u frames: %.1f fps, bus %.0f%%, %u bytes/frame, %u us blocked/frame\n",
+        (unsigned)s.frames, s.fps, s.busUtilization * 100.0f, (unsigned)s.bytesPerFrame, (unsigned)s.blockedUsPerFrame);
+
+    for (uint8_t i = 0; i < PROF_PRIM_COUNT; i++) {
+        const WV_RP2040_LCD_PROF_COUNTERS &c = counters[i];
+        if (!c.calls && !c.transactions) continue;
+        printf("  %-8s calls %lu, bytes %lu, transactions %lu, blocked %llu us\n", primNames[i],
+            (unsigned long)c.calls, (unsigned long)c.bytes, (unsigned long)c.transactions, (unsigned long long)c.blockedUs);
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_Profiler::reset() {
+    memset(counters, 0, sizeof(counters));
+    memset(frames, 0, sizeof(frames));
+    memset(&frame, 0, sizeof(frame));
+    current = PROF_NONE;
+    frameCount = 0;
+    frameStartUs = 0;
+    busUs = 0;
+    busStartUs = 0;
+}
+
+#endif
@@ -0,0 +1,109 @@
+#include "hardware/dma.h"
+#include "GPIO_Util.h"
+#include "WV_RP2040_LCD.h"
+#include "LCD_SPI.h"
+
+WV_RP2040::WV_RP2040_LCD_SPI::WV_RP2040_LCD_SPI() : spi(spi0), frameBits(8), pixelBits(16), isReading(false) {
+}
+
+WV_RP2040::WV_RP2040_LCD_SPI & WV_RP2040::WV_RP2040_LCD_SPI::get_Inst() {
+    static WV_RP2040_LCD_SPI __instance;
+    return __instance;
+}
+
+spi_inst_t * WV_RP2040::WV_RP2040_LCD_SPI::get_SPI() const {
+    return spi;
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::init() {
+    spi_init(spi, WV_RP2040_LCD_SPI_BAUD);
+    frameBits = 8;
+    isHalfByte = false;
+    spi_set_format(spi, frameBits, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    gpio_set_function(WV_RP2040_LCD_CLK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(WV_RP2040_LCD_DIN_PIN, GPIO_FUNC_SPI);
+
+    // DC is toggled by the CPU, take it back in case another transport owned it
+    digital_set_pin_mode(WV_RP2040_LCD_DC_PIN, DIGITAL_OUT);
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::deinit() {
+    spi_deinit(spi);
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::set_FrameBits(uint8_t bits) {
+    if (frameBits == bits) return;
+    wait_Bus();
+    spi_set_format(spi, bits, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    frameBits = bits;
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::put_Nibble() {
+    const uint16_t pad = 0;
+    set_FrameBits(4);
+    spi_write16_blocking(spi, &pad, 1);
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::select(bool setSelected) {
+    if (!setSelected) {
+        pad_Byte();
+
+        // DMA writes leave the RX FIFO overrun, hand the bus back clean for the blocking calls
+        while (spi_is_readable(spi)) (void)spi_get_hw(spi)->dr;
+        spi_get_hw(spi)->icr = SPI_SSPICR_RORIC_BITS;
+        set_FrameBits(8);
+    }
+    digital_write(WV_RP2040_LCD_CS_PIN, (setSelected) ? DIGITAL_LOW : DIGITAL_HIGH);
+
+    // The controller lets go of DIN with the chip select, the SPI can drive it again
+    if (!setSelected && isReading) {
+        gpio_set_function(WV_RP2040_LCD_CLK_PIN, GPIO_FUNC_SPI);
+        gpio_set_function(WV_RP2040_LCD_DIN_PIN, GPIO_FUNC_SPI);
+        isReading = false;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::write_Bytes(bool isData, const uint8_t *data, size_t len) {
+    pad_Byte();
+    set_FrameBits(8);
+    wait_Bus();
+    digital_write(WV_RP2040_LCD_DC_PIN, (isData) ? DIGITAL_HIGH : DIGITAL_LOW);
+    spi_write_blocking(spi, data, len);
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::read_Bytes(uint8_t *data, size_t len, uint8_t dummyBits) {
+    if (!isReading) {
+        wait_Bus();
+        isReading = true;
+    }
+    clock_In(data, len, dummyBits);
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::set_PixelBits(uint8_t bits) {
+    pixelBits = (bits == 12) ? 12 : 16;
+}
+
+bool WV_RP2040::WV_RP2040_LCD_SPI::start_Pixels(int dmaChannel, const uint16_t *src, uint32_t count, bool increment) {
+    // Pixels go out as 16 bit frames, so RGB565 needs no byte swapping. 12 bit frames
+    // clock out back to back, which is the packed three bytes per two pixels of RGB444
+    set_FrameBits(pixelBits);
+    wait_Bus();
+    digital_write(WV_RP2040_LCD_DC_PIN, DIGITAL_HIGH);
+    count_Pixels(pixelBits, count);
+
+    dma_channel_config cfg = dma_channel_get_default_config(dmaChannel);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_dreq(&cfg, spi_get_dreq(spi, true));
+    channel_config_set_read_increment(&cfg, increment);
+    channel_config_set_write_increment(&cfg, false);
+    dma_channel_configure(dmaChannel, &cfg, &spi_get_hw(spi)->dr, src, count, true);
+    return false;
+}
+
+void WV_RP2040::WV_RP2040_LCD_SPI::wait_Bus() {
+    while (spi_is_busy(spi)) tight_loop_contents();
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_SPI::get_MaxPixels() const {
+    return UINT32_MAX;
+}
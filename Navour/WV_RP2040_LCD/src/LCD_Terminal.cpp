@@ -0,0 +1,194 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#if !PICO_NO_HARDWARE
+#include "pico/stdio/driver.h"
+#endif
+#include "LCD_DMA.h"
+#include "LCD_Profiler.h"
+#include "LCD_Terminal.h"
+
+static_assert(WV_RP2040_LCD_TERM_COLS * (WV_RP2040_LCD_FONT_WIDTH + 1) == WV_RP2040_LCD_WIDTH,
+    "Terminal rows must cover the full panel width");
+static_assert(WV_RP2040_LCD_DMA_BUF_PX >= WV_RP2040_LCD_WIDTH, "A line buffer must hold a panel row");
+
+#if !PICO_NO_HARDWARE
+//stdio calls these with its own lock held, they only touch the cell grid until a flush is due
+static void term_OutChars(const char *buf, int len) {
+    WV_RP2040::WV_RP2040_LCD_Terminal::get_Inst().write(buf, len);
+}
+
+static void term_OutFlush() {
+    WV_RP2040::WV_RP2040_LCD_Terminal::get_Inst().flush();
+}
+
+static stdio_driver_t termDriver;
+#endif
+
+WV_RP2040::WV_RP2040_LCD_Terminal::WV_RP2040_LCD_Terminal() :
+    curCol(0), curRow(0), topSlot(0), shownSlot(0), fg(0xFFFF), bg(0x0000), pendingSinceUs(0), isActive(false) {
+    memset(cells, ' ', sizeof(cells));
+    memset(shown, ' ', sizeof(shown));
+}
+
+WV_RP2040::WV_RP2040_LCD_Terminal & WV_RP2040::WV_RP2040_LCD_Terminal::get_Inst() {
+    static WV_RP2040_LCD_Terminal __instance;
+    return __instance;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Terminal::new_Line() {
+    curCol = 0;
+    if (curRow + 1 < WV_RP2040_LCD_TERM_ROWS) {
+        curRow++;
+        return;
+    }
+
+    // The grid moves up, the panel follows with the scroll start address on the next flush
+    memmove(cells[0], cells[1], sizeof(cells) - sizeof(cells[0]));
+    memset(cells[WV_RP2040_LCD_TERM_ROWS - 1], ' ', sizeof(cells[0]));
+    topSlot = (topSlot + 1) % WV_RP2040_LCD_TERM_SLOTS;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Terminal::paint_Cells(uint8_t row, uint8_t col, uint8_t count) {
+    WV_RP2040_LCD_DMA &dma = WV_RP2040_LCD_DMA::get_Inst();
+    const WV_RP2040_LCD_GlyphAtlas &atlas = WV_RP2040_LCD_FONT_1X;
+    const uint8_t cellW = WV_RP2040_LCD_FONT_WIDTH + 1;
+    const uint8_t slot = (topSlot + row) % WV_RP2040_LCD_TERM_SLOTS;
+    const char *text = &cells[row][col];
+    uint16_t x = col * cellW, y = slot * WV_RP2040_LCD_FONT_HEIGHT;
+    uint32_t runW = (uint32_t)count * cellW;
+    uint32_t rowsPerBuf = WV_RP2040_LCD_DMA_BUF_PX / runW;
+
+    dma.queue_Window(x, y, x + runW - 1, y + WV_RP2040_LCD_FONT_HEIGHT - 1);
+    for (uint8_t r = 0; r < WV_RP2040_LCD_FONT_HEIGHT; ) {
+        uint16_t *buf = dma.acquire_LineBuf();
+        uint32_t used = 0;
+
+        for (uint32_t n = 0; n < rowsPerBuf && r < WV_RP2040_LCD_FONT_HEIGHT; n++, r++) {
+            for (uint8_t i = 0; i < count; i++) {
+                uint16_t bits = atlas.rows[WV_RP2040_LCD_GlyphAtlas::get_Glyph(text[i])][r];
+                for (uint16_t mask = 1u << (atlas.width - 1); mask; mask >>= 1) buf[used++] = (bits & mask) ? fg : bg;
+                buf[used++] = bg;
+            }
+        }
+        dma.queue_LineBuf(buf, used);
+    }
+
+    memcpy(&shown[slot][col], text, count);
+}
+
+void WV_RP2040::WV_RP2040_LCD_Terminal::begin(uint16_t setFg, uint16_t setBg) {
+    WV_RP2040_LCD_DMA &dma = WV_RP2040_LCD_DMA::get_Inst();
+    WV_RP2040_LCD &lcd = WV_RP2040_LCD::get_Inst();
+    fg = lcd.get_NativeColor(setFg);
+    bg = lcd.get_NativeColor(setBg);
+
+    // Hardware scrolling moves the frame memory rows, which only run top to bottom unturned
+    lcd.set_Orientation(WV_RP2040_LCD::ORIENT_0);
+
+    // Vertical scroll definition, no fixed areas, the rows below the panel take the next lines
+    uint8_t vscrdef[6] = { 0x00, 0x00, (uint8_t)(WV_RP2040_LCD_GRAM_HEIGHT >> 8), (uint8_t)(WV_RP2040_LCD_GRAM_HEIGHT & 0xFF), 0x00, 0x00 };
+    dma.queue_Command(0x33, vscrdef, 4);
+    dma.queue_Data(vscrdef + 4, 2);
+    uint8_t vscsad[2] = { 0x00, 0x00 };
+    dma.queue_Command(0x37, vscsad, sizeof(vscsad)); // Vertical scroll start address
+
+    // A blank cell is all background, so the cleared frame memory is all blank cells
+    dma.queue_Window(0, 0, WV_RP2040_LCD_WIDTH - 1, WV_RP2040_LCD_GRAM_HEIGHT - 1);
+    dma.queue_Fill(bg, (uint32_t)WV_RP2040_LCD_WIDTH * WV_RP2040_LCD_GRAM_HEIGHT);
+    memset(cells, ' ', sizeof(cells));
+    memset(shown, ' ', sizeof(shown));
+    curCol = 0; curRow = 0;
+    topSlot = 0; shownSlot = 0;
+    pendingSinceUs = 0;
+
+    if (isActive) return;
+    isActive = true;
+#if !PICO_NO_HARDWARE
+    // Output goes to USB and to the panel
+    memset(&termDriver, 0, sizeof(termDriver));
+    termDriver.out_chars = term_OutChars;
+    termDriver.out_flush = term_OutFlush;
+    stdio_set_driver_enabled(&termDriver, true);
+#endif
+}
+
+void WV_RP2040::WV_RP2040_LCD_Terminal::end() {
+    if (!isActive) return;
+
+#if !PICO_NO_HARDWARE
+    stdio_set_driver_enabled(&termDriver, false);
+#endif
+    WV_RP2040_LCD_DMA::get_Inst().queue_Command(0x13, NULL, 0); // Normal display mode on, leaves scrolling
+    isActive = false;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Terminal::write(const char *text, int len) {
+    bool isLineDone = false;
+
+    for (int i = 0; i < len; i++) {
+        char c = text[i];
+        switch (c) {
+        case '\n':
+            new_Line();
+            isLineDone = true;
+            break;
+        case '\r':
+            curCol = 0;
+            break;
+        case '\b':
+            if (curCol) curCol--;
+            break;
+        case '\t':
+            curCol = (curCol + 4) & ~3;
+            if (curCol > WV_RP2040_LCD_TERM_COLS) curCol = WV_RP2040_LCD_TERM_COLS;
+            break;
+        default:
+            if ((uint8_t)c < WV_RP2040_LCD_FONT_FIRST) break;
+
+            // Wrap lazily, a full row followed by a line break does not leave an empty row
+            if (curCol >= WV_RP2040_LCD_TERM_COLS) new_Line();
+            cells[curRow][curCol++] = c;
+            break;
+        }
+    }
+
+    if (!isActive) return;
+    if (!pendingSinceUs) pendingSinceUs = time_us_64();
+    if (isLineDone || time_us_64() - pendingSinceUs >= WV_RP2040_LCD_TERM_BUDGET_US) flush();
+}
+
+void WV_RP2040::WV_RP2040_LCD_Terminal::flush() {
+    if (!isActive) return;
+    WV_RP2040_LCD_PROF_SCOPE(PROF_TEXT);
+
+    // Runs of cells differing from their frame memory slot, a new bottom row is painted below the panel
+    for (uint8_t row = 0; row < WV_RP2040_LCD_TERM_ROWS; row++) {
+        const char *want = cells[row];
+        const char *have = shown[(topSlot + row) % WV_RP2040_LCD_TERM_SLOTS];
+
+        for (uint8_t col = 0; col < WV_RP2040_LCD_TERM_COLS; ) {
+            if (want[col] == have[col]) { col++; continue; }
+
+            uint8_t start = col;
+            while (col < WV_RP2040_LCD_TERM_COLS && want[col] != have[col]) col++;
+            paint_Cells(row, start, col - start);
+        }
+    }
+
+    // Then it scrolls into view
+    if (shownSlot != topSlot) {
+        uint16_t vsp = topSlot * WV_RP2040_LCD_FONT_HEIGHT;
+        uint8_t vscsad[2] = { (uint8_t)(vsp >> 8), (uint8_t)(vsp & 0xFF) };
+        WV_RP2040_LCD_DMA::get_Inst().queue_Command(0x37, vscsad, sizeof(vscsad)); // Vertical scroll start address
+        shownSlot = topSlot;
+    }
+    pendingSinceUs = 0;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Terminal::handle_Pending() {
+    if (pendingSinceUs && time_us_64() - pendingSinceUs >= WV_RP2040_LCD_TERM_BUDGET_US) flush();
+}
+
+bool WV_RP2040::WV_RP2040_LCD_Terminal::is_Active() const {
+    return isActive;
+}
@@ -0,0 +1,46 @@
+#include "LCD_Tiles.h"
+
+static_assert((WV_RP2040_LCD_TILE_SIZE & 1) == 0, "WV_RP2040_LCD_TILE_SIZE must be even");
+
+WV_RP2040::WV_RP2040_LCD_Tiles::WV_RP2040_LCD_Tiles() : isValid(false) {
+}
+
+uint32_t WV_RP2040::WV_RP2040_LCD_Tiles::hash_Tile(const uint16_t *fb, uint16_t tx, uint16_t ty) {
+    uint16_t x0 = tx * WV_RP2040_LCD_TILE_SIZE;
+    uint16_t y0 = ty * WV_RP2040_LCD_TILE_SIZE;
+    uint16_t w = (x0 + WV_RP2040_LCD_TILE_SIZE > WV_RP2040_LCD_WIDTH) ? WV_RP2040_LCD_WIDTH - x0 : WV_RP2040_LCD_TILE_SIZE;
+    uint16_t h = (y0 + WV_RP2040_LCD_TILE_SIZE > WV_RP2040_LCD_HEIGHT) ? WV_RP2040_LCD_HEIGHT - y0 : WV_RP2040_LCD_TILE_SIZE;
+
+    uint32_t hash = 2166136261u;
+    for (uint16_t y = y0; y < y0 + h; y++) {
+        const uint16_t *row = fb + (uint32_t)y * WV_RP2040_LCD_WIDTH + x0;
+        uint16_t x = 0;
+
+        // Word reads when the row start allows it, the M0+ multiplies in a single cycle
+        if (((uintptr_t)row & 3) == 0) {
+            const uint32_t *words = (const uint32_t *)row;
+            for (; x + 1 < w; x += 2) hash = (hash ^ words[x >> 1]) * 16777619u;
+        }
+        for (; x < w; x++) hash = (hash ^ row[x]) * 16777619u;
+    }
+    return hash;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Tiles::invalidate() {
+    isValid = false;
+}
+
+uint16_t WV_RP2040::WV_RP2040_LCD_Tiles::refresh_Row(const uint16_t *fb, uint16_t ty, bool *changed) {
+    uint16_t n = 0;
+    for (uint16_t tx = 0; tx < WV_RP2040_LCD_TILES_X; tx++) {
+        uint32_t hash = hash_Tile(fb, tx, ty);
+        changed[tx] = !isValid || hash != hashes[ty][tx];
+        hashes[ty][tx] = hash;
+        if (changed[tx]) n++;
+    }
+    return n;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Tiles::mark_Valid() {
+    isValid = true;
+}
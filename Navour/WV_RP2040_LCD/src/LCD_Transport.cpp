@@ -0,0 +1,38 @@
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "WV_RP2040_LCD.h"
+#include "LCD_Transport.h"
+
+/*! \brief Clock Bit
+*  \ingroup WV_RP2040_LCD_Transport
+*  \category Local Function
+*
+*  One read clock cycle, the controller shifts out on the falling edge and the bit is
+*  sampled on the rising one.
+*/
+static inline uint8_t clock_Bit() {
+    gpio_put(WV_RP2040_LCD_CLK_PIN, 0);
+    busy_wait_at_least_cycles(WV_RP2040_LCD_READ_HALF_CYCLES);
+    gpio_put(WV_RP2040_LCD_CLK_PIN, 1);
+    uint8_t bit = gpio_get(WV_RP2040_LCD_DIN_PIN) ? 1 : 0;
+    busy_wait_at_least_cycles(WV_RP2040_LCD_READ_HALF_CYCLES);
+    return bit;
+}
+
+void WV_RP2040::WV_RP2040_LCD_Transport::clock_In(uint8_t *data, size_t len, uint8_t dummyBits) {
+    // CLK idles low, DIN stays released to the controller until the chip select goes up
+    gpio_set_function(WV_RP2040_LCD_CLK_PIN, GPIO_FUNC_SIO);
+    gpio_set_function(WV_RP2040_LCD_DIN_PIN, GPIO_FUNC_SIO);
+    gpio_put(WV_RP2040_LCD_CLK_PIN, 0);
+    gpio_set_dir(WV_RP2040_LCD_CLK_PIN, GPIO_OUT);
+    gpio_set_dir(WV_RP2040_LCD_DIN_PIN, GPIO_IN);
+
+    for (uint8_t i = 0; i < dummyBits; i++) clock_Bit();
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = 0;
+        for (uint8_t bit = 0; bit < 8; bit++) b = (uint8_t)((b << 1) | clock_Bit());
+        data[i] = b;
+    }
+
+    gpio_put(WV_RP2040_LCD_CLK_PIN, 0);
+}
@@ -1,8 +1,33 @@
-//#include "hardware/spi.h"
+#include <string.h>
 #include "GPIO_Util.h"
 #include "WV_RP2040_LCD.h"
+#include "LCD_Tiles.h"
+#include "LCD_Blend.h"
+#include "LCD_Backlight.h"
+#include "LCD_Profiler.h"
+#if PICO_NO_HARDWARE
+#include "LCD_Emulator.h"
+#else
+#include "hardware/spi.h"
+#include "hardware/claim.h"
+#include "LCD_SPI.h"
+#include "LCD_PIO.h"
+#endif
 #include "lv_conf.h"
 
+static_assert(WV_RP2040_LCD_DMA_BUF_PX >= WV_RP2040_LCD_WIDTH, "A line buffer must hold a panel row");
+static_assert(WV_RP2040_LCD_PANEL_COL_OFFSET + WV_RP2040_LCD_PANEL_WIDTH <= WV_RP2040_LCD_GRAM_WIDTH &&
+    WV_RP2040_LCD_PANEL_ROW_OFFSET + WV_RP2040_LCD_PANEL_HEIGHT <= WV_RP2040_LCD_GRAM_HEIGHT, "The panel must lie inside the frame memory");
+
+#define MADCTL_MY 0x80 // Row address order
+#define MADCTL_MX 0x40 // Column address order
+#define MADCTL_MV 0x20 // Row/column exchange
+static_assert(WV_RP2040_LCD_ASYNC_DEPTH > 0 && (WV_RP2040_LCD_ASYNC_DEPTH & (WV_RP2040_LCD_ASYNC_DEPTH - 1)) == 0,
+    "WV_RP2040_LCD_ASYNC_DEPTH must be a power of two");
+
+// Module running on core1, shared by every user of the LCD library
+static volatile WV_RP2040::WV_RP2040_LCD::WV_RP2040_LCD_CORE1_OWNER core1Owner = WV_RP2040::WV_RP2040_LCD::CORE1_FREE;
+
 void WV_RP2040::WV_RP2040_LCD::init_Onboard_LCD_Pins() {
     // Initialize the GPIO pins on the LCD
     digital_set_pin_mode(WV_RP2040_LCD_RST_PIN, DIGITAL_OUT);
@@ -12,7 +37,10 @@ void WV_RP2040::WV_RP2040_LCD::init_Onboard_LCD_Pins() {
 }
 
 WV_RP2040::WV_RP2040_LCD::WV_RP2040_LCD() :
-    isInit(false), isInDatM(false), isListening(false), isBLLit(false) {
+    isInit(false), isInDatM(false), isListening(false), isBLLit(false),
+    dma(WV_RP2040_LCD_DMA::get_Inst()), colorMode(COLOR_RGB565),
+    orientation(ORIENT_0), isMirrored(false), originX(0), originY(0), frameBuf(NULL), scratch(), fbWin(), fbCurX(0), fbCurY(0),
+    isPresenting(false), presentMode(PRESENT_DAMAGE), tiles(NULL), presentToken(0), pending(), lastToken(0), doneToken(0) {
     init_Onboard_LCD_Pins();
 
     set_Listen(false);
@@ -49,7 +77,7 @@ bool WV_RP2040::WV_RP2040_LCD::is_Listening() {
 }
 
 void WV_RP2040::WV_RP2040_LCD::set_Backlight(const bool setLit) {
-    digital_write(WV_RP2040_LCD_BL_PIN, (setLit) ? DIGITAL_HIGH : DIGITAL_LOW);
+    WV_RP2040_LCD_Backlight::get_Inst().set_Level((setLit) ? WV_RP2040_LCD_BL_LEVELS - 1 : 0);
     isBLLit = setLit;
 }
 
@@ -57,7 +85,19 @@ bool WV_RP2040::WV_RP2040_LCD::is_BacklightLit() {
     return isBLLit;
 }
 
-void WV_RP2040::WV_RP2040_LCD::initialize_LCD() {
+void WV_RP2040::WV_RP2040_LCD::initialize_LCD(WV_RP2040_LCD_TRANSPORT transport, WV_RP2040_LCD_COLOR_MODE mode) {
+#if PICO_NO_HARDWARE
+    // Host builds only have the ST7789 model
+    (void)transport;
+    dma.set_Transport(WV_RP2040_LCD_Emulator::get_Inst());
+#else
+    if (transport == TRANSPORT_PIO) {
+        dma.set_Transport(WV_RP2040_LCD_PIO::get_Inst());
+    } else {
+        dma.set_Transport(WV_RP2040_LCD_SPI::get_Inst());
+    }
+#endif
+
     // Reset the LCD
     digital_write(WV_RP2040_LCD_RST_PIN, DIGITAL_LOW);
     sleep_ms(100);
@@ -69,91 +109,795 @@ void WV_RP2040::WV_RP2040_LCD::initialize_LCD() {
     sleep_ms(5);
     send_Command(0x11); // Exit sleep mode
     sleep_ms(120);
+
+    // Interface pixel format, 65K colors in 16 bits or 4K colors in 12 bits
+    colorMode = mode;
+    dma.set_PixelBits((mode == COLOR_RGB444) ? 12 : 16);
+    send_Command(0x3A);
+    send_Data((mode == COLOR_RGB444) ? 0x53 : 0x55);
+
+    set_Orientation((WV_RP2040_LCD_ORIENTATION)WV_RP2040_LCD_ROTATION, isMirrored);
     send_Command(0x29); // Display on
 }
 
+bool WV_RP2040::WV_RP2040_LCD::set_Orientation(WV_RP2040_LCD_ORIENTATION rotation, bool setMirrored) {
+    static const uint8_t rotations[4] = { 0x00, MADCTL_MX | MADCTL_MV, MADCTL_MX | MADCTL_MY, MADCTL_MY | MADCTL_MV };
+    uint8_t madctl = rotations[rotation & 3];
+    bool isExchanged = (madctl & MADCTL_MV) != 0;
+
+    // The logical size is fixed at build time
+    if ((isExchanged ? WV_RP2040_LCD_PANEL_HEIGHT : WV_RP2040_LCD_PANEL_WIDTH) != WV_RP2040_LCD_WIDTH) return false;
+
+    // Mirroring flips the logical x axis, the exchange has put it onto the frame memory rows
+    if (setMirrored) madctl ^= (isExchanged) ? MADCTL_MY : MADCTL_MX;
+
+    // The address counters map onto the panel from the end of the frame memory along a mirrored axis
+    uint16_t colOrigin = (madctl & MADCTL_MX) ?
+        WV_RP2040_LCD_GRAM_WIDTH - WV_RP2040_LCD_PANEL_WIDTH - WV_RP2040_LCD_PANEL_COL_OFFSET : WV_RP2040_LCD_PANEL_COL_OFFSET;
+    uint16_t rowOrigin = (madctl & MADCTL_MY) ?
+        WV_RP2040_LCD_GRAM_HEIGHT - WV_RP2040_LCD_PANEL_HEIGHT - WV_RP2040_LCD_PANEL_ROW_OFFSET : WV_RP2040_LCD_PANEL_ROW_OFFSET;
+    originX = (isExchanged) ? rowOrigin : colOrigin;
+    originY = (isExchanged) ? colOrigin : rowOrigin;
+
+    send_Command(0x36); // Memory data access control
+    send_Data(madctl);
+    dma.set_Origin(originX, originY);
+    orientation = rotation;
+    isMirrored = setMirrored;
+
+    // The panel shows the framebuffer turned, all of it has to go out again
+    if (frameBuf) {
+        wait_Present();
+        WV_RP2040_LCD_RECT all = { 0, 0, WV_RP2040_LCD_WIDTH - 1, WV_RP2040_LCD_HEIGHT - 1 };
+        damage.add(all);
+        if (tiles) tiles->invalidate();
+    }
+    return true;
+}
+
+WV_RP2040::WV_RP2040_LCD::WV_RP2040_LCD_ORIENTATION WV_RP2040::WV_RP2040_LCD::get_Orientation() const {
+    return orientation;
+}
+
+bool WV_RP2040::WV_RP2040_LCD::is_Mirrored() const {
+    return isMirrored;
+}
+
+WV_RP2040::WV_RP2040_LCD_COLOR_MODE WV_RP2040::WV_RP2040_LCD::get_ColorMode() const {
+    return colorMode;
+}
+
+bool WV_RP2040::WV_RP2040_LCD::claim_Core1(WV_RP2040_LCD_CORE1_OWNER owner) {
+#if PICO_NO_HARDWARE
+    bool isClaimed = core1Owner == CORE1_FREE || core1Owner == owner;
+    if (isClaimed) core1Owner = owner;
+#else
+    // The claim lock of the SDK keeps both cores from claiming at once
+    uint32_t save = hw_claim_lock();
+    bool isClaimed = core1Owner == CORE1_FREE || core1Owner == owner;
+    if (isClaimed) core1Owner = owner;
+    hw_claim_unlock(save);
+#endif
+    return isClaimed;
+}
+
+WV_RP2040::WV_RP2040_LCD::WV_RP2040_LCD_CORE1_OWNER WV_RP2040::WV_RP2040_LCD::get_Core1Owner() {
+    return core1Owner;
+}
+
+uint16_t WV_RP2040::WV_RP2040_LCD::get_NativeColor(uint16_t color) const {
+    return get_Native(color, colorMode);
+}
+
 void WV_RP2040::WV_RP2040_LCD::send_Command(uint8_t cmd) {
-    set_DataMode(false);
-    set_Listen(true);
-    spi_write_blocking(spi0, &cmd, 1);
-    set_Listen(false);
+    WV_RP2040_LCD_PROF_SCOPE(PROF_COMMAND);
+    dma.queue_Command(cmd, NULL, 0);
+    dma.wait_Idle();
 }
 
 void WV_RP2040::WV_RP2040_LCD::send_Data(uint8_t data) {
-    set_DataMode(true);
-    set_Listen(true);
-    spi_write_blocking(spi0, &data, 1);
-    set_Listen(false);
+    WV_RP2040_LCD_PROF_SCOPE(PROF_COMMAND);
+    dma.queue_Data(&data, 1);
+    dma.wait_Idle();
+}
+
+void WV_RP2040::WV_RP2040_LCD::set_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_WINDOW);
+    if (frameBuf) {
+        wait_Present();
+        fbWin.x0 = x0; fbWin.y0 = y0; fbWin.x1 = x1; fbWin.y1 = y1;
+        fbCurX = x0;
+        fbCurY = y0;
+
+        // Only the on-screen part of the window is damage
+        if (x0 < WV_RP2040_LCD_WIDTH && y0 < WV_RP2040_LCD_HEIGHT) {
+            WV_RP2040_LCD_RECT r = fbWin;
+            if (r.x1 >= WV_RP2040_LCD_WIDTH) r.x1 = WV_RP2040_LCD_WIDTH - 1;
+            if (r.y1 >= WV_RP2040_LCD_HEIGHT) r.y1 = WV_RP2040_LCD_HEIGHT - 1;
+            damage.add(r);
+        }
+        return;
+    }
+
+    dma.queue_Window(x0, y0, x1, y1);
+}
+
+void WV_RP2040::WV_RP2040_LCD::fb_Write(const uint16_t *pixels, uint16_t color, uint32_t count) {
+    while (count) {
+        uint32_t run = fbWin.x1 - fbCurX + 1;
+        if (run > count) run = count;
+
+        if (fbCurY < WV_RP2040_LCD_HEIGHT) {
+            uint16_t *dst = frameBuf + (uint32_t)fbCurY * WV_RP2040_LCD_WIDTH + fbCurX;
+            for (uint32_t i = 0; i < run; i++) {
+                if (fbCurX + i >= WV_RP2040_LCD_WIDTH) break;
+                dst[i] = pixels ? pixels[i] : color;
+            }
+        }
+
+        if (pixels) pixels += run;
+        count -= run;
+        fbCurX += run;
+        if (fbCurX > fbWin.x1) {
+            fbCurX = fbWin.x0;
+            fbCurY = (fbCurY >= fbWin.y1) ? fbWin.y0 : fbCurY + 1;
+        }
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD::write_Pixels(const uint16_t *pixels, uint32_t count) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_PIXELS);
+    if (frameBuf && colorMode == COLOR_RGB565) {
+        fb_Write(pixels, 0, count);
+        return;
+    }
+
+    // Fill one line buffer while the other one is clocked out, RGB444 is converted on the way
+    uint16_t local[WV_RP2040_LCD_STREAM_CHUNK];
+    while (count) {
+        uint32_t cap = (frameBuf) ? WV_RP2040_LCD_STREAM_CHUNK : WV_RP2040_LCD_DMA_BUF_PX;
+        uint32_t n = (count < cap) ? count : cap;
+        uint16_t *buf = (frameBuf) ? local : dma.acquire_LineBuf();
+        if (colorMode == COLOR_RGB444) convert_RGB444(buf, pixels, n);
+        else memcpy(buf, pixels, n * sizeof(uint16_t));
+
+        if (frameBuf) fb_Write(buf, 0, n);
+        else dma.queue_LineBuf(buf, n);
+        pixels += n;
+        count -= n;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD::fill_Pixels(uint16_t color, uint32_t count) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_PIXELS);
+    color = get_Native(color, colorMode);
+    if (frameBuf) {
+        fb_Write(NULL, color, count);
+        return;
+    }
+
+    dma.queue_Fill(color, count);
 }
 
 void WV_RP2040::WV_RP2040_LCD::draw_Pixel(uint16_t x, uint16_t y, uint16_t color) {
-    send_Command(0x2A); // Column address set
-    send_Data(x >> 8);
-    send_Data(x & 0xFF);
-    send_Data((x+1) >> 8);
-    send_Data((x+1) & 0xFF);
+    WV_RP2040_LCD_PROF_SCOPE(PROF_RECT);
+    set_Window(x, y, x, y);
+    fill_Pixels(color, 1);
+}
+
+void WV_RP2040::WV_RP2040_LCD::emit_Run(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    // Clip to the panel, the controller wraps around on out of range windows
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (w > WV_RP2040_LCD_WIDTH - x) w = WV_RP2040_LCD_WIDTH - x;
+    if (h > WV_RP2040_LCD_HEIGHT - y) h = WV_RP2040_LCD_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    set_Window(x, y, x + w - 1, y + h - 1);
+    fill_Pixels(color, (uint32_t)w * h);
+}
+
+void WV_RP2040::WV_RP2040_LCD::line_Runs(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color) {
+    // Walk the major axis, so axis aligned lines come out as a single run
+    bool isSteep = abs(y1 - y0) > abs(x1 - x0);
+    if (isSteep) {
+        int32_t t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+    }
 
-    send_Command(0x2B); // Row address set
-    send_Data(y >> 8);
-    send_Data(y & 0xFF);
-    send_Data((y+1) >> 8);
-    send_Data((y+1) & 0xFF);
+    int32_t dx = abs(x1 - x0), dy = abs(y1 - y0);
+    int32_t sx = (x0 < x1) ? 1 : -1, sy = (y0 < y1) ? 1 : -1;
+    int32_t err = dx / 2, y = y0, runStart = x0;
 
-    send_Command(0x2C); // Memory write
-    send_Data(color >> 8);
-    send_Data(color & 0xFF);
+    for (int32_t x = x0; ; x += sx) {
+        bool isLast = (x == x1), isStep = false;
+        if (!isLast) {
+            err -= dy;
+            if (err < 0) { err += dx; isStep = true; }
+        }
+        if (!isLast && !isStep) continue;
+
+        int32_t start = (runStart < x) ? runStart : x, len = abs(x - runStart) + 1;
+        if (isSteep) emit_Run(y, start, 1, len, color);
+        else emit_Run(start, y, len, 1, color);
+        if (isLast) break;
+
+        y += sy;
+        runStart = x + sx;
+    }
 }
 
-void WV_RP2040::WV_RP2040_LCD::draw_Line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
-    // Bresenham's line algorithm
-    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
-    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy, e2;
+/*! \brief Circle Extent
+*  \ingroup WV_RP2040_LCD
+*  \category Local Function
+*
+*  Half width of the row dy away from the center of a circle of radius r, or -1 past
+*  the circle. The r^2 + r bound rounds the edge like a midpoint circle.
+*/
+static int32_t circle_Extent(int32_t r, int32_t dy) {
+    if (r < 0 || dy > r) return -1;
 
-    while (true) {
-        draw_Pixel(x0, y0, color);
-        if (x0 == x1 && y0 == y1) break;
-        e2 = 2 * err;
-        if (e2 >= dy) { err += dy; x0 += sx; }
-        if (e2 <= dx) { err += dx; y0 += sy; }
+    // Bit by bit integer square root
+    uint32_t v = (uint32_t)(r * r + r - dy * dy), res = 0, bit = 1u << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= res + bit) { v -= res + bit; res = (res >> 1) + bit; }
+        else res >>= 1;
+        bit >>= 2;
     }
+    return (int32_t)res;
 }
 
-void WV_RP2040::WV_RP2040_LCD::draw_Rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    for (uint16_t i = 0; i < h; i++) {
-        draw_Line(x, y + i, x + w - 1, y + i, color);
+void WV_RP2040::WV_RP2040_LCD::round_Runs(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint16_t color, bool isFilled) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_ROUND);
+    if (w <= 0 || h <= 0) return;
+    if (r > (w - 1) / 2) r = (w - 1) / 2;
+    if (r > (h - 1) / 2) r = (h - 1) / 2;
+
+    // Centers of the corner arcs, the rows between them are straight
+    int32_t cl = x + r, cr = x + w - 1 - r, ct = y + r, cb = y + h - 1 - r;
+    int32_t yStart = (y < 0) ? 0 : y;
+    int32_t yEnd = (y + h - 1 < WV_RP2040_LCD_HEIGHT - 1) ? y + h - 1 : WV_RP2040_LCD_HEIGHT - 1;
+
+    for (int32_t yy = yStart; yy <= yEnd; yy++) {
+        int32_t dy = (yy < ct) ? ct - yy : (yy > cb) ? yy - cb : 0;
+        int32_t e = circle_Extent(r, dy);
+        int32_t l = cl - e, rt = cr + e;
+
+        // The outline is the outer shape minus the shape inset by one pixel
+        bool isSolid = isFilled || yy == y || yy == y + h - 1 || (r > 0 && dy >= r);
+        int32_t ei = (r > 0) ? circle_Extent(r - 1, dy) : -1;
+        int32_t il = cl - ei, ir = cr + ei;
+        if (isSolid || il > ir) {
+            emit_Run(l, yy, rt - l + 1, 1, color);
+            continue;
+        }
+
+        // Keep at least one pixel per side so steep arcs stay connected
+        int32_t lEnd = (il - 1 > l) ? il - 1 : l;
+        int32_t rStart = (ir + 1 < rt) ? ir + 1 : rt;
+        emit_Run(l, yy, lEnd - l + 1, 1, color);
+        emit_Run(rStart, yy, rt - rStart + 1, 1, color);
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_LINE);
+    line_Runs(x0, y0, x1, y1, color);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_HLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_RECT);
+    emit_Run(x, y, w, 1, color);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_VLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_RECT);
+    emit_Run(x, y, 1, h, color);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_Rectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_RECT);
+    emit_Run(x, y, w, h, color);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_RoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
+    round_Runs(x, y, w, h, r, color, false);
+}
+
+void WV_RP2040::WV_RP2040_LCD::fill_RoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
+    round_Runs(x, y, w, h, r, color, true);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color) {
+    round_Runs(cx - r, cy - r, 2 * r + 1, 2 * r + 1, r, color, false);
+}
+
+void WV_RP2040::WV_RP2040_LCD::fill_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color) {
+    round_Runs(cx - r, cy - r, 2 * r + 1, 2 * r + 1, r, color, true);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_Triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_POLYGON);
+    const WV_RP2040_LCD_POINT pts[3] = { { x0, y0 }, { x1, y1 }, { x2, y2 } };
+    draw_Polygon(pts, 3, color);
+}
+
+void WV_RP2040::WV_RP2040_LCD::fill_Triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_POLYGON);
+    const WV_RP2040_LCD_POINT pts[3] = { { x0, y0 }, { x1, y1 }, { x2, y2 } };
+    fill_Polygon(pts, 3, color);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_Polygon(const WV_RP2040_LCD_POINT *pts, size_t count, uint16_t color) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_POLYGON);
+    for (size_t i = 0; i < count; i++) {
+        const WV_RP2040_LCD_POINT &a = pts[i], &b = pts[(i + 1) % count];
+        line_Runs(a.x, a.y, b.x, b.y, color);
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD::fill_Polygon(const WV_RP2040_LCD_POINT *pts, size_t count, uint16_t color) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_POLYGON);
+    if (!pts || count == 0) return;
+
+    int32_t yMin = pts[0].y, yMax = pts[0].y;
+    for (size_t i = 1; i < count; i++) {
+        if (pts[i].y < yMin) yMin = pts[i].y;
+        if (pts[i].y > yMax) yMax = pts[i].y;
+    }
+    if (yMin < 0) yMin = 0;
+    if (yMax > WV_RP2040_LCD_HEIGHT - 1) yMax = WV_RP2040_LCD_HEIGHT - 1;
+
+    for (int32_t y = yMin; y <= yMax; y++) {
+        int32_t xMin = INT32_MAX, xMax = INT32_MIN;
+
+        for (size_t i = 0; i < count; i++) {
+            const WV_RP2040_LCD_POINT *a = &pts[i], *b = &pts[(i + 1) % count];
+            if (a->y > b->y) { const WV_RP2040_LCD_POINT *t = a; a = b; b = t; }
+            if (y < a->y || y > b->y) continue;
+
+            int32_t lo = a->x, hi = b->x;
+            if (a->y != b->y) {
+                // Cover the edge across the whole pixel row, as the outline would
+                int32_t dx = b->x - a->x, dy2 = 2 * (b->y - a->y);
+                int32_t t0 = 2 * (y - a->y) - 1, t1 = 2 * (y - a->y) + 1;
+                if (t0 < 0) t0 = 0;
+                if (t1 > dy2) t1 = dy2;
+                int64_t n0 = (int64_t)dx * t0, n1 = (int64_t)dx * t1;
+                lo = a->x + (int32_t)((n0 >= 0) ? (n0 + dy2 / 2) / dy2 : (n0 - dy2 / 2) / dy2);
+                hi = a->x + (int32_t)((n1 >= 0) ? (n1 + dy2 / 2) / dy2 : (n1 - dy2 / 2) / dy2);
+            }
+            if (lo > hi) { int32_t t = lo; lo = hi; hi = t; }
+            if (lo < xMin) xMin = lo;
+            if (hi > xMax) xMax = hi;
+        }
+
+        if (xMin <= xMax) emit_Run(xMin, y, xMax - xMin + 1, 1, color);
     }
 }
 
-void WV_RP2040::WV_RP2040_LCD::draw_Char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg) {
-    for (int8_t i = 0; i < 5; i++ ) {
-        uint8_t line = font[c * 5 + i];
-        for (int8_t j = 0; j < 8; j++, line >>= 1) {
-            if (line & 1) {
-                draw_Pixel(x + i, y + j, color);
+void WV_RP2040::WV_RP2040_LCD::draw_Text(uint16_t x, uint16_t y, const char *str, size_t len, uint16_t color, uint16_t bg, uint8_t scale) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_TEXT);
+    const WV_RP2040_LCD_GlyphAtlas &atlas = get_FontAtlas(scale);
+
+    // Clip to the panel, the trailing glyph gap is not part of the line
+    if (len == 0 || x >= WV_RP2040_LCD_WIDTH || y >= WV_RP2040_LCD_HEIGHT) return;
+    uint32_t w = (uint32_t)len * atlas.advance - atlas.scale;
+    uint16_t visW = (w > (uint32_t)(WV_RP2040_LCD_WIDTH - x)) ? WV_RP2040_LCD_WIDTH - x : w;
+    uint16_t visH = (atlas.height > WV_RP2040_LCD_HEIGHT - y) ? WV_RP2040_LCD_HEIGHT - y : atlas.height;
+
+    set_Window(x, y, x + visW - 1, y + visH - 1);
+    color = get_Native(color, colorMode);
+    bg = get_Native(bg, colorMode);
+
+    // Rows are expanded straight into the DMA line buffers, several rows per buffer
+    uint16_t *span = (frameBuf) ? scratch : dma.acquire_LineBuf();
+    uint32_t used = 0;
+
+    for (uint16_t row = 0; row < visH; row++) {
+        if (used + visW > WV_RP2040_LCD_DMA_BUF_PX) {
+            if (frameBuf) fb_Write(span, 0, used);
+            else {
+                dma.queue_LineBuf(span, used);
+                span = dma.acquire_LineBuf();
+            }
+            used = 0;
+        }
+
+        uint16_t *out = span + used;
+        if (used && row % atlas.scale) {
+            // Scaled rows repeat the row above
+            memcpy(out, out - visW, visW * sizeof(uint16_t));
+        } else {
+            uint8_t base = row / atlas.scale;
+            uint16_t px = 0;
+            for (size_t i = 0; px < visW; i++) {
+                uint16_t bits = atlas.rows[WV_RP2040_LCD_GlyphAtlas::get_Glyph(str[i])][base];
+                for (uint16_t mask = 1u << (atlas.width - 1); mask && px < visW; mask >>= 1) {
+                    out[px++] = (bits & mask) ? color : bg;
+                }
+                for (uint8_t s = 0; s < atlas.scale && px < visW; s++) out[px++] = bg;
+            }
+        }
+        used += visW;
+    }
+
+    if (frameBuf) fb_Write(span, 0, used);
+    else dma.queue_LineBuf(span, used);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_Char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg, uint8_t scale) {
+    draw_Text(x, y, &c, 1, color, bg, scale);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_String(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t scale) {
+    draw_Text(x, y, str, strlen(str), color, bg, scale);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_Image(int16_t x, int16_t y, const WV_RP2040_LCD_IMAGE &img, uint8_t alpha) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_IMAGE);
+    if (!alpha) return;
+
+    // Clip to the panel, the columns and rows outside are stepped over in the stream
+    int32_t cx0 = (x < 0) ? -x : 0, cy0 = (y < 0) ? -y : 0;
+    int32_t cx1 = img.width, cy1 = img.height;
+    if (x + cx1 > WV_RP2040_LCD_WIDTH) cx1 = WV_RP2040_LCD_WIDTH - x;
+    if (y + cy1 > WV_RP2040_LCD_HEIGHT) cy1 = WV_RP2040_LCD_HEIGHT - y;
+    if (cx1 <= cx0 || cy1 <= cy0) return;
+
+    const uint16_t visW = cx1 - cx0;
+    const uint32_t skipRight = img.width - cx1;
+    WV_RP2040_LCD_ImageReader reader(img);
+    reader.skip((uint32_t)cy0 * img.width);
+
+    if (alpha < 255) {
+        // Decoded pixel by pixel and blended in place over what lies underneath, key pixels leave it
+        struct Over { WV_RP2040_LCD_ImageReader *reader; const WV_RP2040_LCD_IMAGE *img; uint32_t cx0, skipRight; uint8_t alpha; };
+        Over over = { &reader, &img, (uint32_t)cx0, skipRight, alpha };
+        blend_Rows(x + cx0, y + cy0, visW, cy1 - cy0, 0, true, [](uint16_t *px, uint16_t, uint16_t w, void *ctx) {
+            const Over *o = (const Over *)ctx;
+            o->reader->skip(o->cx0);
+            for (uint16_t i = 0; i < w; i++) {
+                uint16_t c = o->reader->next();
+                if (!o->img->isKeyed || c != o->img->key) px[i] = blend_RGB565(c, px[i], o->alpha);
+            }
+            o->reader->skip(o->skipRight);
+        }, &over);
+        return;
+    }
+
+    if (!img.isKeyed) {
+        set_Window(x + cx0, y + cy0, x + cx1 - 1, y + cy1 - 1);
+
+        // Rows are decoded straight into the DMA line buffers, several rows per buffer
+        uint16_t *span = (frameBuf) ? scratch : dma.acquire_LineBuf();
+        uint32_t used = 0;
+        for (int32_t row = cy0; row < cy1; row++) {
+            if (used + visW > WV_RP2040_LCD_DMA_BUF_PX) {
+                if (frameBuf) fb_Write(span, 0, used);
+                else {
+                    dma.queue_LineBuf(span, used);
+                    span = dma.acquire_LineBuf();
+                }
+                used = 0;
+            }
+
+            uint16_t *out = span + used;
+            reader.skip(cx0);
+            if (colorMode == COLOR_RGB444) {
+                for (uint16_t i = 0; i < visW; i++) out[i] = to_RGB444(reader.next());
             } else {
-                draw_Pixel(x + i, y + j, bg);
+                for (uint16_t i = 0; i < visW; i++) out[i] = reader.next();
             }
+            reader.skip(skipRight);
+            used += visW;
         }
+
+        if (frameBuf) fb_Write(span, 0, used);
+        else dma.queue_LineBuf(span, used);
+        return;
+    }
+
+    // Every opaque span of a row gets its own window, the key color ends a span
+    for (int32_t row = cy0; row < cy1; row++) {
+        reader.skip(cx0);
+        for (int32_t col = cx0; col < cx1; ) {
+            uint16_t c = reader.next();
+            int32_t start = col++;
+            if (c == img.key) continue;
+
+            uint16_t *span = (frameBuf) ? scratch : dma.acquire_LineBuf();
+            uint32_t n = 0;
+            span[n++] = get_Native(c, colorMode);
+            while (col < cx1) {
+                c = reader.next();
+                col++;
+                if (c == img.key) break;
+                span[n++] = get_Native(c, colorMode);
+            }
+
+            set_Window(x + start, y + row, x + start + n - 1, y + row);
+            if (frameBuf) fb_Write(span, 0, n);
+            else dma.queue_LineBuf(span, n);
+        }
+        reader.skip(skipRight);
     }
 }
 
-void WV_RP2040::WV_RP2040_LCD::draw_String(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg) {
-    while (*str) {
-        draw_Char(x, y, *str++, color, bg);
-        x += 6; // Advance to next character
+void WV_RP2040::WV_RP2040_LCD::blend_Rows(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t bg, bool readBack,
+    WV_RP2040_LCD_BLEND_ROW blend, void *ctx) {
+    // The framebuffer costs nothing to read, the panel is read chunk by chunk and moves its window
+    readBack = readBack || frameBuf;
+    const uint16_t rowsPerBuf = WV_RP2040_LCD_DMA_BUF_PX / w;
+    if (!readBack) set_Window(x, y, x + w - 1, y + h - 1);
+
+    for (uint16_t row = 0; row < h; ) {
+        uint16_t n = (h - row < rowsPerBuf) ? h - row : rowsPerBuf;
+        uint32_t count = (uint32_t)n * w;
+        uint16_t *span = (frameBuf) ? scratch : dma.acquire_LineBuf();
+
+        if (readBack) read_Region(x, y + row, x + w - 1, y + row + n - 1, span);
+        else for (uint32_t i = 0; i < count; i++) span[i] = bg;
+        for (uint16_t r = 0; r < n; r++) blend(span + (uint32_t)r * w, row + r, w, ctx);
+        if (colorMode == COLOR_RGB444) convert_RGB444(span, span, count);
+
+        if (readBack) set_Window(x, y + row, x + w - 1, y + row + n - 1);
+        if (frameBuf) fb_Write(span, 0, count);
+        else dma.queue_LineBuf(span, count);
+        row += n;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD::fill_RectAlpha(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, uint8_t alpha) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_BLEND);
+    if (alpha == 255) {
+        emit_Run(x, y, w, h, color);
+        return;
     }
+
+    // Clip to the panel
+    int32_t x0 = (x < 0) ? 0 : x, y0 = (y < 0) ? 0 : y;
+    int32_t x1 = x + (int32_t)w, y1 = y + (int32_t)h;
+    if (x1 > WV_RP2040_LCD_WIDTH) x1 = WV_RP2040_LCD_WIDTH;
+    if (y1 > WV_RP2040_LCD_HEIGHT) y1 = WV_RP2040_LCD_HEIGHT;
+    if (!alpha || x1 <= x0 || y1 <= y0) return;
+
+    struct Fill { uint16_t color; uint8_t alpha; };
+    Fill fill = { color, alpha };
+    blend_Rows(x0, y0, x1 - x0, y1 - y0, 0, true, [](uint16_t *px, uint16_t, uint16_t w, void *ctx) {
+        const Fill *f = (const Fill *)ctx;
+        blend_Fill(px, f->color, f->alpha, w);
+    }, &fill);
+}
+
+void WV_RP2040::WV_RP2040_LCD::draw_Mask(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *mask, uint16_t color, uint16_t bg) {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_BLEND);
+
+    // Clip to the panel, the mask rows keep their full stride
+    int32_t cx0 = (x < 0) ? -x : 0, cy0 = (y < 0) ? -y : 0;
+    int32_t cx1 = w, cy1 = h;
+    if (x + cx1 > WV_RP2040_LCD_WIDTH) cx1 = WV_RP2040_LCD_WIDTH - x;
+    if (y + cy1 > WV_RP2040_LCD_HEIGHT) cy1 = WV_RP2040_LCD_HEIGHT - y;
+    if (cx1 <= cx0 || cy1 <= cy0) return;
+
+    struct Mask { const uint8_t *mask; uint16_t stride; uint16_t color; };
+    Mask m = { mask + (uint32_t)cy0 * w + cx0, w, color };
+    blend_Rows(x + cx0, y + cy0, cx1 - cx0, cy1 - cy0, bg, false, [](uint16_t *px, uint16_t row, uint16_t w, void *ctx) {
+        const Mask *m = (const Mask *)ctx;
+        blend_Mask(px, m->color, m->mask + (uint32_t)row * m->stride, w);
+    }, &m);
 }
 
 void WV_RP2040::WV_RP2040_LCD::clear_Screen(uint16_t color) {
-    draw_Rectangle(0, 0, 240, 240, color); // Assuming a 240x240 LCD
+    WV_RP2040_LCD_PROF_SCOPE(PROF_RECT);
+    draw_Rectangle(0, 0, WV_RP2040_LCD_WIDTH, WV_RP2040_LCD_HEIGHT, color);
 }
 
 uint8_t WV_RP2040::WV_RP2040_LCD::read_Data() {
+    dma.wait_Idle();
+#if PICO_NO_HARDWARE
+    return 0;
+#else
+    if (&dma.get_Transport() != &WV_RP2040_LCD_SPI::get_Inst()) return 0;
+
     set_DataMode(true);
     set_Listen(true);
     uint8_t data;
-    spi_read_blocking(spi0, 0, &data, 1);
+    spi_read_blocking(WV_RP2040_LCD_SPI::get_Inst().get_SPI(), 0, &data, 1);
     set_Listen(false);
     return data;
+#endif
+}
+
+bool WV_RP2040::WV_RP2040_LCD::read_Region(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t *dst) {
+    if (x1 < x0 || y1 < y0 || x1 >= WV_RP2040_LCD_WIDTH) return false;
+
+    if (frameBuf) {
+        if (y1 >= WV_RP2040_LCD_HEIGHT) return false;
+        for (uint16_t y = y0; y <= y1; y++) {
+            const uint16_t *row = &frameBuf[y * WV_RP2040_LCD_WIDTH + x0];
+            for (uint16_t x = 0; x <= x1 - x0; x++) *dst++ = (colorMode == COLOR_RGB444) ? to_RGB565(row[x]) : row[x];
+        }
+        return true;
+    }
+    // The address counters run over the frame memory the way MADCTL turns it
+    uint16_t rows = (orientation & 1) ? WV_RP2040_LCD_GRAM_WIDTH : WV_RP2040_LCD_GRAM_HEIGHT;
+    if (y1 >= rows - originY) return false;
+
+    // The read needs the bus to itself, the ring has released the chip select once it is idle
+    dma.wait_Idle();
+    WV_RP2040_LCD_Transport &bus = dma.get_Transport();
+    x0 += originX; x1 += originX;
+    y0 += originY; y1 += originY;
+    uint8_t cmd[1] = { 0x2A }; // Column address set
+    uint8_t caset[4] = { (uint8_t)(x0 >> 8), (uint8_t)(x0 & 0xFF), (uint8_t)(x1 >> 8), (uint8_t)(x1 & 0xFF) };
+    uint8_t raset[4] = { (uint8_t)(y0 >> 8), (uint8_t)(y0 & 0xFF), (uint8_t)(y1 >> 8), (uint8_t)(y1 & 0xFF) };
+
+    bus.select(true);
+    bus.write_Bytes(false, cmd, 1);
+    bus.write_Bytes(true, caset, sizeof(caset));
+    cmd[0] = 0x2B; // Row address set
+    bus.write_Bytes(false, cmd, 1);
+    bus.write_Bytes(true, raset, sizeof(raset));
+    cmd[0] = 0x2E; // Memory read
+    bus.write_Bytes(false, cmd, 1);
+
+    // RGB666, three bytes per pixel with every channel left aligned, only the first chunk waits for the dummy clocks
+    uint8_t rgb[3 * WV_RP2040_LCD_STREAM_CHUNK];
+    uint32_t left = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+    uint8_t dummyBits = WV_RP2040_LCD_RAMRD_DUMMY_BITS;
+    while (left) {
+        uint32_t n = (left < WV_RP2040_LCD_STREAM_CHUNK) ? left : WV_RP2040_LCD_STREAM_CHUNK;
+        bus.read_Bytes(rgb, 3 * n, dummyBits);
+        dummyBits = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t *p = &rgb[3 * i];
+            *dst++ = (uint16_t)(((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3));
+        }
+        left -= n;
+    }
+    bus.select(false);
+    return true;
+}
+
+void WV_RP2040::WV_RP2040_LCD::wait_Idle() {
+    dma.wait_Idle();
+}
+
+void WV_RP2040::WV_RP2040_LCD::wait_Present() {
+    if (isPresenting) {
+        wait_Done(presentToken);
+        isPresenting = false;
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD::token_Done(void *ctx) {
+    WV_RP2040_LCD_PENDING *p = (WV_RP2040_LCD_PENDING *)ctx;
+    if (p->cb) p->cb(p->token, p->ctx);
+
+    // Retired after the callback, the slot may be reused from here on
+    get_Inst().doneToken = p->token;
+}
+
+WV_RP2040::WV_RP2040_LCD_TOKEN WV_RP2040::WV_RP2040_LCD::submit(WV_RP2040_LCD_DONE_CB cb, void *ctx) {
+    // Back-pressure, the oldest batch has to be done before its slot is taken again
+    if (!can_Submit()) {
+        WV_RP2040_LCD_PROF_BLOCK_BEGIN();
+        while (!can_Submit()) tight_loop_contents();
+        WV_RP2040_LCD_PROF_BLOCK_END();
+    }
+
+    WV_RP2040_LCD_TOKEN token = lastToken + 1;
+    WV_RP2040_LCD_PENDING &p = pending[token & (WV_RP2040_LCD_ASYNC_DEPTH - 1)];
+    p.token = token;
+    p.cb = cb;
+    p.ctx = ctx;
+    lastToken = token;
+
+    // Batches complete in order, the ring runs the callback once the jobs before it are sent
+    dma.queue_Notify(token_Done, &p);
+    return token;
+}
+
+bool WV_RP2040::WV_RP2040_LCD::is_Done(WV_RP2040_LCD_TOKEN token) const {
+    return (int32_t)(doneToken - token) >= 0;
+}
+
+void WV_RP2040::WV_RP2040_LCD::wait_Done(WV_RP2040_LCD_TOKEN token) {
+    if (is_Done(token)) return;
+
+    WV_RP2040_LCD_PROF_BLOCK_BEGIN();
+    while (!is_Done(token)) tight_loop_contents();
+    WV_RP2040_LCD_PROF_BLOCK_END();
+}
+
+uint8_t WV_RP2040::WV_RP2040_LCD::get_InFlight() const {
+    return (uint8_t)(lastToken - doneToken);
+}
+
+bool WV_RP2040::WV_RP2040_LCD::can_Submit() const {
+    return get_InFlight() < WV_RP2040_LCD_ASYNC_DEPTH;
+}
+
+void WV_RP2040::WV_RP2040_LCD::set_Framebuffer(uint16_t *fb) {
+    wait_Present();
+    frameBuf = fb;
+    damage.clear();
+    if (tiles) tiles->invalidate();
+}
+
+uint16_t * WV_RP2040::WV_RP2040_LCD::get_Framebuffer() const {
+    return frameBuf;
+}
+
+void WV_RP2040::WV_RP2040_LCD::set_DamageCap(uint8_t cap) {
+    damage.set_Cap(cap);
+}
+
+const WV_RP2040::WV_RP2040_LCD_Damage & WV_RP2040::WV_RP2040_LCD::get_Damage() const {
+    return damage;
+}
+
+void WV_RP2040::WV_RP2040_LCD::set_PresentMode(WV_RP2040_LCD_PRESENT_MODE mode) {
+    if (mode == PRESENT_TILES) {
+        if (!tiles) tiles = new WV_RP2040_LCD_Tiles();
+        tiles->invalidate();
+    }
+    presentMode = mode;
+}
+
+void WV_RP2040::WV_RP2040_LCD::queue_FbRegion(const WV_RP2040_LCD_RECT &r) {
+    uint16_t w = r.x1 - r.x0 + 1;
+
+    dma.queue_Window(r.x0, r.y0, r.x1, r.y1);
+    if (w == WV_RP2040_LCD_WIDTH) {
+        // Full width rows are contiguous in the framebuffer, send them as one run
+        dma.queue_Copy(frameBuf + (uint32_t)r.y0 * WV_RP2040_LCD_WIDTH, (uint32_t)w * (r.y1 - r.y0 + 1));
+    } else {
+        for (uint16_t y = r.y0; y <= r.y1; y++) {
+            dma.queue_Copy(frameBuf + (uint32_t)y * WV_RP2040_LCD_WIDTH + r.x0, w);
+        }
+    }
+}
+
+void WV_RP2040::WV_RP2040_LCD::present() {
+    WV_RP2040_LCD_PROF_SCOPE(PROF_PRESENT);
+    if (!frameBuf) return;
+
+    if (presentMode == PRESENT_TILES) {
+        bool changed[WV_RP2040_LCD_TILES_X];
+
+        for (uint16_t ty = 0; ty < WV_RP2040_LCD_TILES_Y; ty++) {
+            if (!tiles->refresh_Row(frameBuf, ty, changed)) continue;
+
+            // Coalesce the runs of changed tiles into one window each
+            uint16_t tx = 0;
+            while (tx < WV_RP2040_LCD_TILES_X) {
+                if (!changed[tx]) { tx++; continue; }
+                uint16_t start = tx;
+                while (tx < WV_RP2040_LCD_TILES_X && changed[tx]) tx++;
+
+                WV_RP2040_LCD_RECT r;
+                r.x0 = start * WV_RP2040_LCD_TILE_SIZE;
+                r.y0 = ty * WV_RP2040_LCD_TILE_SIZE;
+                r.x1 = tx * WV_RP2040_LCD_TILE_SIZE - 1;
+                r.y1 = r.y0 + WV_RP2040_LCD_TILE_SIZE - 1;
+                if (r.x1 >= WV_RP2040_LCD_WIDTH) r.x1 = WV_RP2040_LCD_WIDTH - 1;
+                if (r.y1 >= WV_RP2040_LCD_HEIGHT) r.y1 = WV_RP2040_LCD_HEIGHT - 1;
+                queue_FbRegion(r);
+                isPresenting = true;
+            }
+        }
+        tiles->mark_Valid();
+    } else {
+        for (uint8_t i = 0; i < damage.get_Count(); i++) {
+            queue_FbRegion(damage.get_Rect(i));
+            isPresenting = true;
+        }
+    }
+
+    // Only this batch reads the framebuffer, the next draw call waits for it alone
+    if (isPresenting) presentToken = submit();
+    damage.clear();
 }
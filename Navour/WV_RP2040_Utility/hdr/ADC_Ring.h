@@ -0,0 +1,117 @@
+#ifndef _RP2040_ADC_RING_HEADER_
+#define _RP2040_ADC_RING_HEADER_
+
+#include <stdint.h>
+
+/** \file WV_RP2040_Utility/ADC_Ring.h
+ *  \headerfile ADC_Ring.h
+ *  \defgroup WV_RP2040_ADC_Ring WV_RP2040_ADC_Ring api keeps the latest ADC samples of a channel.
+ *  \author TheClownDev
+ *
+ *  \brief Ring buffer of raw ADC samples, written from an interrupt and read from the main loop.
+ *
+ *  One writer, WV_RP2040_ADC::start_Stream() pushes from its timer interrupt, and any number
+ *  of readers, each one keeps the count of the samples it already took. A reader falling
+ *  behind by more than the ring holds loses the oldest samples, not the newest.
+ *
+ *  \subsection WV_RP2040_Utility APIs related to the WV_RP2040 HW.
+ *  \addtogroup WV_RP2040_ADC_Ring
+ *
+ *  \include ADC_Ring.h
+*/
+
+/*! \namespace WV_RP2040
+ *  \brief Namspace for the WV_RP2040 APIs
+ *  \subsection WV_RP2040_Utility
+*/
+namespace WV_RP2040 {
+
+/*! \def WV RP2040 ADC Ring Size [256]
+*  \brief Value
+*  \details Samples the ring holds, a power of two.
+*  \ingroup WV_RP2040_ADC_Ring
+*/
+#ifndef WV_RP2040_ADC_RING_SIZE
+#define WV_RP2040_ADC_RING_SIZE 256 // Samples kept
+#endif
+
+static_assert((WV_RP2040_ADC_RING_SIZE & (WV_RP2040_ADC_RING_SIZE - 1)) == 0, "WV_RP2040_ADC_RING_SIZE must be a power of two");
+
+/*! \brief ring buffer of raw ADC samples
+ *  \ingroup WV_RP2040_ADC_Ring
+ *  \class WV_RP2040_ADC_Ring
+ */
+class WV_RP2040_ADC_Ring {
+private:
+    uint16_t samples[WV_RP2040_ADC_RING_SIZE];  /*!< Raw 12 bit samples */
+    volatile uint32_t head;                     /*!< Samples pushed since start up */
+
+public:
+    /*! \brief Constructor
+     *  \ingroup WV_RP2040_ADC_Ring
+     */
+    WV_RP2040_ADC_Ring() : samples(), head(0) {}
+
+    WV_RP2040_ADC_Ring( const WV_RP2040_ADC_Ring & ) = delete;
+    WV_RP2040_ADC_Ring& operator=( const WV_RP2040_ADC_Ring & ) = delete;
+
+    /*! \brief Push
+    *   \ingroup WV_RP2040_ADC_Ring
+    *
+    *   \category Local Function
+    *
+    *   Adds a sample, overwriting the oldest one. Only one writer may push.
+    *
+    *   \param raw - The raw sample.
+    */
+    inline void push( const uint16_t raw ) {
+        uint32_t at = head;
+        samples[at & (WV_RP2040_ADC_RING_SIZE - 1)] = raw;
+        __atomic_thread_fence(__ATOMIC_RELEASE); //the sample is in before the readers see it
+        head = at + 1;
+    }
+
+    /*! \brief Get Head
+    *   \ingroup WV_RP2040_ADC_Ring
+    *
+    *   \category Local Function
+    *
+    *   \return Returns the count of the samples pushed since start up, where a new reader starts.
+    */
+    inline uint32_t get_Head() const {
+        return head;
+    }
+
+    /*! \brief Read
+    *   \ingroup WV_RP2040_ADC_Ring
+    *
+    *   \category Local Function
+    *
+    *   Copies the samples a reader did not take yet, oldest first.
+    *
+    *   \param tail - The samples the reader took so far, advanced past the copied ones.
+    *   \param dst - Where the samples go.
+    *   \param maxCount - The room in dst.
+    *
+    *   \return Returns the count of the samples copied, 0 if the reader is up to date.
+    */
+    inline uint32_t read( uint32_t &tail, uint16_t *dst, const uint32_t maxCount ) const {
+        uint32_t at = head;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        //lost ones are skipped, the oldest sample kept is next
+        if (at - tail > WV_RP2040_ADC_RING_SIZE)
+            tail = at - WV_RP2040_ADC_RING_SIZE;
+
+        uint32_t count = at - tail;
+        if (count > maxCount)
+            count = maxCount;
+        for (uint32_t i = 0; i < count; i++)
+            dst[i] = samples[(tail + i) & (WV_RP2040_ADC_RING_SIZE - 1)];
+        tail += count;
+        return count;
+    }
+};
+}
+
+#endif
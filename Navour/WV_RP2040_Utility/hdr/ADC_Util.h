@@ -11,6 +11,7 @@
 #endif
 
 #include "List_Util.h"
+#include "ADC_Ring.h"
 
 
 /** \file WV_RP2040_Utility/ADC_Util.h
@@ -48,6 +49,8 @@ namespace WV_RP2040 {
 
         bool isADCInit = false;
 
+        volatile uint8_t tempStreams = 0; //streams keeping the temparature sensor on
+
         /*! \brief Constructor
          *  \ingroup WV_RP2040_ADC
          *  
@@ -69,6 +72,15 @@ namespace WV_RP2040 {
          */
         WV_RP2040_ADC& operator=( const WV_RP2040_ADC & ) = delete;
 
+        /*! \brief Stream Callback
+         *  \ingroup WV_RP2040_ADC
+         *
+         *  \category Local Function
+         *
+         *  Timer interrupt of a stream, pushes one sample into its ring.
+         */
+        static bool stream_CB( repeating_timer_t *t );
+
     public:
 
         /*! \brief WV RP2040 ADC AINSEL Pins
@@ -100,6 +112,17 @@ namespace WV_RP2040 {
             ADC_GPIO_PIN_BAT                = 29, //BAT Aquisition PIN
         } WV_RP2040_ADC_GPIO_PINS;
 
+        /*! \brief WV RP2040 ADC Stream
+        *   \ingroup WV_RP2040_ADC
+        *
+        *   A channel sampled into a ring buffer from a timer interrupt, owned by the caller.
+        */
+        typedef struct _WV_RP2040_ADC_STREAM_ {
+            repeating_timer_t timer;            //the sampling timer
+            WV_RP2040_ADC_Ring *ring;           //where the samples go
+            uint8_t apin;                       //the sampled Ainsel pin
+        } WV_RP2040_ADC_STREAM;
+
         /*! \brief Get Instance
         *   \ingroup WV_RP2040_ADC
         *
@@ -159,6 +182,58 @@ namespace WV_RP2040 {
         */
         static float conv_Temp( const float value, const bool inFarhenhite );
 
+        /*! \brief Convert Raw Temparature
+        *   \ingroup WV_RP2040_ADC
+        *
+        *   \category Global Function
+        *
+        *   Converts a raw reading of the onboard temparature sensor.
+        *
+        *   \param raw - The raw 12 bit reading.
+        *
+        *   \return Returns the temparature in celcius.
+        */
+        static float conv_RawTemp( const uint16_t raw );
+
+        /*! \brief Read Raw
+        *   \ingroup WV_RP2040_ADC
+        *
+        *   \category Local Function
+        *
+        *   Takes one conversion of a channel, safe next to running streams.
+        *
+        *   \param apin - The Ainsel pin to read, the temparature sensor has to be enabled for ADC_AINSEL_PIN_TEMP.
+        *
+        *   \return Returns the raw 12 bit reading.
+        */
+        uint16_t read_Raw( const WV_RP2040_ADC_AINSEL_PINS apin ) const;
+
+        /*! \brief Start Stream
+        *   \ingroup WV_RP2040_ADC
+        *
+        *   \category Local Function
+        *
+        *   Samples a channel into a ring buffer at a fixed rate, from a timer interrupt.
+        *   get_sampled_result() runs the ADC free and must not be used while streams run.
+        *
+        *   \param stream - The stream, has to stay alive until stop_Stream().
+        *   \param ring - The ring buffer the samples go to.
+        *   \param apin - The Ainsel pin to sample.
+        *   \param intervalMs - The time between two samples, 20 for 50 Hz.
+        *
+        *   \return Returns false if there was no timer left.
+        */
+        bool start_Stream( WV_RP2040_ADC_STREAM &stream, WV_RP2040_ADC_Ring &ring, const WV_RP2040_ADC_AINSEL_PINS apin, const int32_t intervalMs );
+
+        /*! \brief Stop Stream
+        *   \ingroup WV_RP2040_ADC
+        *
+        *   \category Local Function
+        *
+        *   \param stream - The stream started with start_Stream().
+        */
+        void stop_Stream( WV_RP2040_ADC_STREAM &stream );
+
         /*! \brief Is Battery Powered
         *   \ingroup WV_RP2040_ADC
         *
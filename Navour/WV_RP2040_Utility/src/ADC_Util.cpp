@@ -1,4 +1,5 @@
 #include "ADC_Util.h"
+#include "hardware/sync.h"
 
 
 WV_RP2040::WV_RP2040_ADC & WV_RP2040::WV_RP2040_ADC::get_Inst()
@@ -30,14 +31,13 @@ float WV_RP2040::WV_RP2040_ADC::get_OnboardTemparature(bool inFarhenhite ) const
         return 0.0f;
 
     adc_set_temp_sensor_enabled(true);
-    adc_select_input(ADC_AINSEL_PIN_TEMP);
     
-    //get the adc reading and convert into float
-    float adcVoltage = (float)adc_read() * voltageConversionFactor;
-    //convert to temparature in celcius
-    float tempC = 27.0f - ( adcVoltage - 0.706 ) / 0.001721f;
+    //get the adc reading and convert into temparature in celcius
+    float tempC = conv_RawTemp(read_Raw(ADC_AINSEL_PIN_TEMP));
 
-    adc_set_temp_sensor_enabled(false);
+    //a stream of the sensor keeps it on
+    if (!tempStreams)
+        adc_set_temp_sensor_enabled(false);
 
     if (!inFarhenhite)
         return tempC;
@@ -53,6 +53,61 @@ float WV_RP2040::WV_RP2040_ADC::conv_Temp( const float value, const bool inFarhe
         return ( value - 32 ) * 5 / 9;
 }
 
+float WV_RP2040::WV_RP2040_ADC::conv_RawTemp( const uint16_t raw )
+{
+    float adcVoltage = (float)raw * voltageConversionFactor;
+    return 27.0f - ( adcVoltage - 0.706f ) / 0.001721f;
+}
+
+uint16_t WV_RP2040::WV_RP2040_ADC::read_Raw( const WV_RP2040_ADC_AINSEL_PINS apin ) const
+{
+    //a stream interrupt between the select and the read would read its own channel here
+    uint32_t irq = save_and_disable_interrupts();
+    adc_select_input(apin);
+    uint16_t raw = adc_read();
+    restore_interrupts(irq);
+    return raw;
+}
+
+bool WV_RP2040::WV_RP2040_ADC::stream_CB( repeating_timer_t *t )
+{
+    WV_RP2040_ADC_STREAM *stream = (WV_RP2040_ADC_STREAM *)t->user_data;
+    stream->ring->push(get_Inst().read_Raw((WV_RP2040_ADC_AINSEL_PINS)stream->apin));
+    return true;
+}
+
+bool WV_RP2040::WV_RP2040_ADC::start_Stream( WV_RP2040_ADC_STREAM &stream, WV_RP2040_ADC_Ring &ring, const WV_RP2040_ADC_AINSEL_PINS apin, const int32_t intervalMs )
+{
+    if ( !isADCInit )
+        return false;
+
+    stream.ring = &ring;
+    stream.apin = apin;
+
+    if (apin == ADC_AINSEL_PIN_TEMP) {
+        tempStreams++;
+        adc_set_temp_sensor_enabled(true);
+    } else {
+        adc_gpio_init(ADC_GPIO_PIN_0 + apin);
+    }
+
+    //negative, the interval is kept from start to start, the rate does not drift
+    if (add_repeating_timer_ms(-intervalMs, stream_CB, &stream, &stream.timer))
+        return true;
+
+    if (apin == ADC_AINSEL_PIN_TEMP && !--tempStreams)
+        adc_set_temp_sensor_enabled(false);
+    return false;
+}
+
+void WV_RP2040::WV_RP2040_ADC::stop_Stream( WV_RP2040_ADC_STREAM &stream )
+{
+    cancel_repeating_timer(&stream.timer);
+
+    if (stream.apin == ADC_AINSEL_PIN_TEMP && tempStreams && !--tempStreams)
+        adc_set_temp_sensor_enabled(false);
+}
+
 bool WV_RP2040::WV_RP2040_ADC::is_BatPow()
 {
 #if defined CYW43_WL_GPIO_VBUS_PIN